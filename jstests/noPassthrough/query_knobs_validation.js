@@ -46,7 +46,10 @@ const expectedParamDefaults = {
     internalQueryPlannerGenerateCoveredWholeIndexScans: false,
     internalQueryIgnoreUnknownJSONSchemaKeywords: false,
     internalQueryProhibitBlockingMergeOnMongoS: false,
-    internalQuerySlotBasedExecutionMaxStaticIndexScanIntervals: 1000
+    internalQuerySlotBasedExecutionMaxStaticIndexScanIntervals: 1000,
+    internalQuerySlotBasedExecutionHashJoinApproxMemoryUseInBytes: 100 * 1024 * 1024,
+    internalQueryInMatchHashedLookupThreshold: 64,
+    internalQueryUnpackBucketPushDownEventFilter: false
 };
 
 function assertDefaultParameterValues() {
@@ -198,6 +201,17 @@ assertSetParameterSucceeds("internalQuerySlotBasedExecutionMaxStaticIndexScanInt
 assertSetParameterFails("internalQuerySlotBasedExecutionMaxStaticIndexScanIntervals", 0);
 assertSetParameterFails("internalQuerySlotBasedExecutionMaxStaticIndexScanIntervals", -1);
 
+assertSetParameterSucceeds("internalQuerySlotBasedExecutionHashJoinApproxMemoryUseInBytes", 1);
+assertSetParameterFails("internalQuerySlotBasedExecutionHashJoinApproxMemoryUseInBytes", 0);
+assertSetParameterFails("internalQuerySlotBasedExecutionHashJoinApproxMemoryUseInBytes", -1);
+
+assertSetParameterSucceeds("internalQueryInMatchHashedLookupThreshold", 1000);
+assertSetParameterSucceeds("internalQueryInMatchHashedLookupThreshold", 0);
+assertSetParameterFails("internalQueryInMatchHashedLookupThreshold", -1);
+
+assertSetParameterSucceeds("internalQueryUnpackBucketPushDownEventFilter", true);
+assertSetParameterSucceeds("internalQueryUnpackBucketPushDownEventFilter", false);
+
 assertSetParameterSucceeds("internalQueryEnableSlotBasedExecutionEngine", true);
 assertSetParameterSucceeds("internalQueryEnableSlotBasedExecutionEngine", false);
 
@@ -263,6 +263,17 @@ function testDbCheckParameters() {
         {dbCheck: multiBatchSimpleCollName, minKey: start, maxKey: end, maxSize: maxSize}));
     awaitDbCheckCompletion(db);
     checkEntryBounds(start, start + maxCount);
+
+    // Waiting for each batch to replicate doesn't change what gets checked.
+    clearLog();
+    assert.commandWorked(db.runCommand({
+        dbCheck: multiBatchSimpleCollName,
+        minKey: start,
+        maxKey: end,
+        batchWriteConcern: {w: "majority"}
+    }));
+    awaitDbCheckCompletion(db);
+    checkEntryBounds(start, end);
 }
 
 testDbCheckParameters();
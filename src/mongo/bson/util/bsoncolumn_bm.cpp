@@ -0,0 +1,121 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/util/bsoncolumn.h"
+#include "mongo/bson/util/bsoncolumnbuilder.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Compresses the elements produced by 'makeElement' for every index in [0, count) into a BSONColumn
+ * binary and returns an object holding it as its only field. An empty object produced by
+ * 'makeElement' is stored as a skip.
+ */
+template <typename MakeElement>
+BSONObj buildColumn(int count, MakeElement makeElement) {
+    BSONColumnBuilder columnBuilder("f"_sd);
+    for (int i = 0; i < count; ++i) {
+        if (auto obj = makeElement(i); obj.isEmpty()) {
+            columnBuilder.skip();
+        } else {
+            columnBuilder.append(obj.firstElement());
+        }
+    }
+
+    BSONObjBuilder builder;
+    builder.append(columnBuilder.fieldName(), columnBuilder.finalize());
+    return builder.obj();
+}
+
+/**
+ * Decompresses every element of 'columnObj' on each iteration, which exercises Simple-8b decoding
+ * and delta expansion for the type stored in the column.
+ */
+void runDecompress(benchmark::State& state, const BSONObj& columnObj) {
+    size_t totalBytes = 0;
+    int size;
+    columnObj.firstElement().binData(size);
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BSONColumn column(columnObj.firstElement());
+        benchmark::DoNotOptimize(std::distance(column.begin(), column.end()));
+        totalBytes += size;
+    }
+
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_decompressIncreasingInt64(benchmark::State& state) {
+    runDecompress(state, buildColumn(state.range(0), [](int i) {
+                      return BSON("f" << static_cast<long long>(i));
+                  }));
+}
+
+void BM_decompressRepeatedInt32(benchmark::State& state) {
+    runDecompress(state, buildColumn(state.range(0), [](int i) { return BSON("f" << 1); }));
+}
+
+void BM_decompressDates(benchmark::State& state) {
+    runDecompress(state, buildColumn(state.range(0), [](int i) {
+                      return BSON("f" << Date_t::fromMillisSinceEpoch(1000000000000 + i * 1000));
+                  }));
+}
+
+void BM_decompressTimestamps(benchmark::State& state) {
+    runDecompress(state, buildColumn(state.range(0), [](int i) {
+                      return BSON("f" << Timestamp(1000000 + i, 0));
+                  }));
+}
+
+void BM_decompressDoubles(benchmark::State& state) {
+    runDecompress(state, buildColumn(state.range(0), [](int i) {
+                      return BSON("f" << 100.0 + (i % 10) * 0.5);
+                  }));
+}
+
+void BM_decompressWithSkips(benchmark::State& state) {
+    runDecompress(state, buildColumn(state.range(0), [](int i) {
+                      return i % 3 ? BSON("f" << static_cast<long long>(i)) : BSONObj();
+                  }));
+}
+
+BENCHMARK(BM_decompressIncreasingInt64)->Arg(1000);
+BENCHMARK(BM_decompressRepeatedInt32)->Arg(1000);
+BENCHMARK(BM_decompressDates)->Arg(1000);
+BENCHMARK(BM_decompressTimestamps)->Arg(1000);
+BENCHMARK(BM_decompressDoubles)->Arg(1000);
+BENCHMARK(BM_decompressWithSkips)->Arg(1000);
+
+}  // namespace
+}  // namespace mongo
@@ -451,7 +451,15 @@ protected:
         // we bake that assumption in here. This decision should be revisited soon.
         DataView(grow(sizeof(t))).write(tagLittleEndian(t));
     }
-    /* "slow" portion of 'grow()'  */
+    /* "slow" portion of 'grow()'
+     *
+     * Growing to the next power of two keeps the total bytes copied linear in the final size, and
+     * realloc() can often extend the allocation in place. The buffers are not pooled: a finished
+     * buffer is handed off as a SharedBuffer (for instance as the body of a reply Message) whose
+     * other holders may outlive the builder, so there is no point at which it could safely be
+     * reclaimed for reuse. Callers that know the eventual size up front can construct the builder
+     * with it instead.
+     */
     void grow_reallocate(int minSize) {
         if (minSize > BufferMaxSize) {
             growFailure(minSize);
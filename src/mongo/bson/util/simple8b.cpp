@@ -777,8 +777,7 @@ void Simple8b<T>::Iterator::_loadBlock() {
 template <typename T>
 void Simple8b<T>::Iterator::_loadValue() {
     // Mask out the value of current slot
-    auto shiftedMask = _mask << _shift;
-    uint64_t value = (_current & shiftedMask) >> _shift;
+    uint64_t value = (_current >> _shift) & _mask;
 
     // Check if this a skip
     if (value == _mask) {
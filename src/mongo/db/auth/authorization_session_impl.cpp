@@ -766,18 +766,21 @@ bool AuthorizationSessionImpl::_isAuthorizedForPrivilege(const Privilege& privil
             if (!(it->getResourcePattern() == resourceSearchList[i]))
                 continue;
 
-            ActionSet userActions = it->getActions();
-            unmetRequirements.removeAllActionsFromSet(userActions);
+            unmetRequirements.removeAllActionsFromSet(it->getActions());
 
             if (unmetRequirements.empty())
                 return true;
         }
     }
 
+    // Each User already holds its role graph flattened into one privilege per resource pattern,
+    // so this is at most one hash lookup and one bitset subtraction per user and search-list
+    // entry. The user cache itself is only consulted by _refreshUserInfoAsNeeded() once a cached
+    // UserHandle has been invalidated.
     for (const auto& user : _authenticatedUsers) {
         for (int i = 0; i < resourceSearchListLength; ++i) {
-            ActionSet userActions = user->getActionsForResource(resourceSearchList[i]);
-            unmetRequirements.removeAllActionsFromSet(userActions);
+            unmetRequirements.removeAllActionsFromSet(
+                user->getActionsForResource(resourceSearchList[i]));
 
             if (unmetRequirements.empty()) {
                 return true;
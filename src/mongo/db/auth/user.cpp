@@ -89,10 +89,11 @@ const User::CredentialData& User::getCredentials() const {
     return _credentials;
 }
 
-const ActionSet User::getActionsForResource(const ResourcePattern& resource) const {
+const ActionSet& User::getActionsForResource(const ResourcePattern& resource) const {
+    static const ActionSet kEmptyActionSet;
     stdx::unordered_map<ResourcePattern, Privilege>::const_iterator it = _privileges.find(resource);
     if (it == _privileges.end()) {
-        return ActionSet();
+        return kEmptyActionSet;
     }
     return it->second.getActions();
 }
@@ -164,9 +164,10 @@ public:
     const CredentialData& getCredentials() const;
 
     /**
-     * Gets the set of actions this user is allowed to perform on the given resource.
+     * Gets the set of actions this user is allowed to perform on the given resource. The returned
+     * reference is owned by this User, or is a shared empty set if the resource is not found.
      */
-    const ActionSet getActionsForResource(const ResourcePattern& resource) const;
+    const ActionSet& getActionsForResource(const ResourcePattern& resource) const;
 
     /**
      * Returns true if the user has is allowed to perform an action on the given resource.
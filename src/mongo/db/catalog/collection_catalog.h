@@ -427,6 +427,8 @@ private:
         stdx::unordered_map<CollectionUUID, std::shared_ptr<Collection>, CollectionUUID::Hash>;
     using OrderedCollectionMap =
         std::map<std::pair<std::string, CollectionUUID>, std::shared_ptr<Collection>>;
+    // Namespace lookups are a single hash probe whatever the number of collections, so a read
+    // pays for hashing the namespace string but not for the size of the catalog.
     using NamespaceCollectionMap =
         stdx::unordered_map<NamespaceString, std::shared_ptr<Collection>>;
     using DatabaseProfileSettingsMap = StringMap<ProfileSettings>;
@@ -96,7 +96,23 @@ void BM_CollectionCatalogWriteWithGlobalExclusiveLock(benchmark::State& state) {
     }
 }
 
+void BM_CollectionCatalogLookupCollectionByNamespace(benchmark::State& state) {
+    auto serviceContext = setupServiceContext();
+    ThreadClient threadClient(serviceContext);
+    ServiceContext::UniqueOperationContext opCtx = threadClient->makeOperationContext();
+
+    createCollectionsAndLocker(opCtx.get(), state.range(0));
+
+    const NamespaceString nss("collection_catalog_bm", std::to_string(state.range(0) / 2));
+    auto catalog = CollectionCatalog::get(opCtx.get());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(catalog->lookupCollectionByNamespace(opCtx.get(), nss));
+    }
+}
+
 BENCHMARK(BM_CollectionCatalogWrite)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_CollectionCatalogWriteWithGlobalExclusiveLock)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogLookupCollectionByNamespace)->Ranges({{{1}, {100'000}}});
 
 }  // namespace mongo
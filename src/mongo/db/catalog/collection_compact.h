@@ -39,6 +39,11 @@ namespace mongo {
  *
  * Returns the number of bytes of stable storage and index size that were freed. If the total
  * size decreased, the return value is positive. Otherwise, the return value is negative.
+ *
+ * When the record store supports online compaction, as WiredTiger's does, the collection lock is
+ * downgraded to an intent lock before any work starts, so reads and writes continue while the
+ * collection and its indexes are compacted. The work is done synchronously on the caller's thread,
+ * one table at a time.
  */
 StatusWith<int64_t> compactCollection(OperationContext* opCtx,
                                       const NamespaceString& collectionNss);
@@ -985,6 +985,9 @@ void CollectionImpl::_cappedDeleteAsNeeded(OperationContext* opCtx,
         record = cursor->next();
     }
 
+    // Documents are removed one at a time rather than by truncating a range of the record store,
+    // as the oplog does with its stones: each deleted document must also be unindexed and, for
+    // replicated collections, generate its own delete oplog entry.
     while (sizeSaved < sizeOverCap || docsRemoved < docsOverCap) {
         if (!record) {
             break;
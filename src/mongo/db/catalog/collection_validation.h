@@ -88,6 +88,13 @@ enum class RepairMode {
  * The combination of background = true and options of anything other than kNoFullValidation is
  * prohibited.
  *
+ * The record store is traversed first, adding each document's keys to IndexConsistency's hash
+ * buckets, and then each index is traversed in turn, removing its keys from them. The buckets are
+ * not synchronized, so these traversals run one after another on the calling thread. A second
+ * pass over the data is only made when the first finds an inconsistency. Background validation
+ * reads a single timestamped snapshot under intent locks, so it does not block writes while it
+ * runs, but it always validates the whole collection.
+ *
  * @return OK if the validate run successfully
  *         OK will be returned even if corruption is found
  *         details will be in 'results'.
@@ -381,6 +381,12 @@ Status _createCollection(OperationContext* opCtx,
                           str::stream() << "A view already exists. NS: " << nss);
         }
 
+        // The record store can already act as the primary index on _id: RecordIds are built from
+        // the KeyString of _id, and the planner turns _id bounds into collection scan bounds.
+        // Opening this to general collections, or to a user-chosen key, still needs answers for
+        // what buckets never hit: _id values of different types that compare equal share a
+        // RecordId because TypeBits are discarded, the key is not collation-aware, and secondary
+        // indexes store the whole _id KeyString as their RecordId.
         if (collectionOptions.clusteredIndex && !nss.isTimeseriesBucketsCollection()) {
             return Status(
                 ErrorCodes::InvalidOptions,
@@ -1379,6 +1379,9 @@ Status IndexCatalogImpl::_indexFilteredRecords(OperationContext* opCtx,
     InsertDeleteOptions options;
     prepareInsertDeleteOptions(opCtx, coll->ns(), index->descriptor(), &options);
 
+    // Keys are generated and inserted one record at a time rather than sorted across the whole
+    // group: each record's keys must be written at that record's own timestamp, so reordering keys
+    // across records would interleave the transaction's commit timestamps.
     for (auto bsonRecord : bsonRecords) {
         invariant(bsonRecord.id != RecordId());
 
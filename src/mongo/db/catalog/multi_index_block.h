@@ -311,6 +311,12 @@ private:
         InsertDeleteOptions options;
     };
 
+    /**
+     * Persists the state needed to resume this build. This is only done on clean shutdown: it
+     * forces every sorter to spill, and the saved sorter files are only consistent with the side
+     * writes tables as of that shutdown checkpoint. After an unclean shutdown, startup recovery
+     * clears the temp directory and these builds restart from the collection scan.
+     */
     void _writeStateToDisk(OperationContext* opCtx, const CollectionPtr& collection) const;
 
     BSONObj _constructStateObject(OperationContext* opCtx, const CollectionPtr& collection) const;
@@ -331,6 +337,9 @@ private:
     /**
      * Performs a collection scan on the given collection and inserts the relevant index keys into
      * the external sorter.
+     *
+     * The multikey tracking and resumable-index-build sorter state in MultiIndexBlock::_indexes
+     * assume this single scan, so it runs on the calling thread.
      */
     void _doCollectionScan(OperationContext* opCtx,
                            const CollectionPtr& collection,
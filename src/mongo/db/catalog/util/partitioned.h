@@ -301,6 +301,20 @@ public:
      */
     Partitioned() : _mutexes(nPartitions), _partitions(nPartitions) {}
 
+    /**
+     * Constructs a partitioned version of a AssociativeContainer, with `nPartitions` partitions,
+     * each of which is constructed from `args`. Useful for containers which are not default
+     * constructible, such as those that are bounded in size.
+     */
+    template <typename... Args>
+    explicit Partitioned(const Args&... args) : _mutexes(nPartitions) {
+        // Reserve up front so that the partitions are constructed in place and never relocated.
+        _partitions.reserve(nPartitions);
+        for (std::size_t i = 0; i < nPartitions; ++i) {
+            _partitions.emplace_back(args...);
+        }
+    }
+
     Partitioned(const Partitioned&) = delete;
     Partitioned(Partitioned&&) = default;
     Partitioned& operator=(const Partitioned&) = delete;
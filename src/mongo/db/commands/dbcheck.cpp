@@ -45,6 +45,8 @@
 #include "mongo/db/repl/dbcheck.h"
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/optime.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/write_concern_options.h"
 #include "mongo/idl/command_generic_argument.h"
 #include "mongo/util/background.h"
 
@@ -67,6 +69,7 @@ struct DbCheckCollectionInfo {
     int64_t maxCount;
     int64_t maxSize;
     int64_t maxRate;
+    boost::optional<WriteConcernOptions> batchWriteConcern;
 };
 
 /**
@@ -117,7 +120,8 @@ std::unique_ptr<DbCheckRun> singleCollectionRun(OperationContext* opCtx,
     auto maxCount = invocation.getMaxCount();
     auto maxSize = invocation.getMaxSize();
     auto maxRate = invocation.getMaxCountPerSecond();
-    auto info = DbCheckCollectionInfo{nss, start, end, maxCount, maxSize, maxRate};
+    auto info = DbCheckCollectionInfo{
+        nss, start, end, maxCount, maxSize, maxRate, invocation.getBatchWriteConcern()};
     auto result = std::make_unique<DbCheckRun>();
     result->push_back(info);
     return result;
@@ -146,7 +150,13 @@ std::unique_ptr<DbCheckRun> fullDatabaseRun(OperationContext* opCtx,
             break;
         }
 
-        DbCheckCollectionInfo info{coll->ns(), BSONKey::min(), BSONKey::max(), max, max, rate};
+        DbCheckCollectionInfo info{coll->ns(),
+                                   BSONKey::min(),
+                                   BSONKey::max(),
+                                   max,
+                                   max,
+                                   rate,
+                                   invocation.getBatchWriteConcern()};
         result->push_back(info);
     }
 
@@ -278,6 +288,20 @@ private:
 
             auto stats = result.getValue();
 
+            // Throttle on replication: don't start the next batch until this one's oplog entry
+            // satisfies the requested write concern.
+            if (info.batchWriteConcern) {
+                auto status = _waitForBatchWriteConcern(*info.batchWriteConcern, stats.time);
+                if (!status.isOK()) {
+                    entry = dbCheckErrorHealthLogEntry(info.nss,
+                                                       "dbCheck failed waiting for writeConcern",
+                                                       OplogEntriesEnum::Batch,
+                                                       status);
+                    HealthLog::get(Client::getCurrent()->getServiceContext()).log(*entry);
+                    return;
+                }
+            }
+
             start = stats.lastKey;
 
             // Update our running totals.
@@ -440,6 +464,19 @@ private:
         return result;
     }
 
+    /**
+     * Wait for the batch oplog entry at 'time' to satisfy 'writeConcern'.
+     */
+    Status _waitForBatchWriteConcern(const WriteConcernOptions& writeConcern,
+                                     const repl::OpTime& time) {
+        auto uniqueOpCtx = Client::getCurrent()->makeOperationContext();
+        auto opCtx = uniqueOpCtx.get();
+
+        return repl::ReplicationCoordinator::get(opCtx)
+            ->awaitReplication(opCtx, time, writeConcern)
+            .status;
+    }
+
     /**
      * Return `true` iff the primary the check is running on has stepped down.
      */
@@ -511,7 +548,8 @@ public:
                "              maxKey: <last key, inclusive>,\n"
                "              maxCount: <max number of docs>,\n"
                "              maxSize: <max size of docs>,\n"
-               "              maxCountPerSecond: <max rate in docs/sec> } "
+               "              maxCountPerSecond: <max rate in docs/sec>,\n"
+               "              batchWriteConcern: <write concern to wait for per batch> } "
                "to check a collection.\n"
                "Invoke with {dbCheck: 1} to check all collections in the database.";
     }
@@ -808,7 +808,9 @@ public:
     std::size_t reserveBytesForReply() const override {
         // The extra 1K is an artifact of how we construct batches. We consider a batch to be full
         // when it exceeds the goal batch size. In the case that we are just below the limit and
-        // then read a large document, the extra 1K helps prevent a final realloc+memcpy.
+        // then read a large document, the extra 1K helps prevent a final realloc+memcpy. With
+        // this reservation each document is copied exactly once, into the contiguous reply Message
+        // that the transport layer sends as a single buffer.
         return FindCommon::kMaxBytesToReturnToClientAtOnce + 1024u;
     }
 
@@ -32,6 +32,9 @@
 #include <benchmark/benchmark.h>
 
 #include "mongo/base/string_data.h"
+#include "mongo/db/client.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
 #include "mongo/idl/command_generic_argument.h"
 
 namespace mongo {
@@ -70,9 +73,21 @@ void BM_IsReplyStripArgument(benchmark::State& state) {
     }
 }
 
+// Measures the per-operation cost of creating and destroying an OperationContext, which includes
+// constructing every OperationContext decoration linked into the benchmark.
+void BM_MakeOperationContext(benchmark::State& state) {
+    setGlobalServiceContext(ServiceContext::make());
+    ThreadClient threadClient(getGlobalServiceContext());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(threadClient->makeOperationContext());
+    }
+}
+
 BENCHMARK(BM_IsGeneric)->DenseRange(0, keys.size() - 1);
 BENCHMARK(BM_IsRequestStripArgument)->DenseRange(0, keys.size() - 1);
 BENCHMARK(BM_IsReplyStripArgument)->DenseRange(0, keys.size() - 1);
+BENCHMARK(BM_MakeOperationContext);
 
 }  // namespace
 }  // namespace mongo
@@ -486,7 +486,9 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
     request->partitioned = (mode == MODE_IX || mode == MODE_IS);
     request->mode = mode;
 
-    // For intent modes, try the PartitionedLockHead
+    // For intent modes, try the PartitionedLockHead. Once a resource has a PartitionedLockHead in
+    // this locker's partition, uncontended IS/IX requests only take the partition mutex and never
+    // touch the LockBucket shared by all lockers of the resource.
     if (request->partitioned) {
         Partition* partition = _getPartition(request);
         stdx::lock_guard<SimpleMutex> scopedLock(partition->mutex);
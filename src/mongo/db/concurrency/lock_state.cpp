@@ -38,6 +38,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/json.h"
 #include "mongo/db/concurrency/flow_control_ticketholder.h"
+#include "mongo/db/concurrency/lock_state_gen.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/flow_control.h"
@@ -1026,6 +1027,21 @@ void LockerImpl::_lockComplete(OperationContext* opCtx,
     invariant(result == LOCK_OK);
     unlockOnErrorGuard.dismiss();
     _setWaitingResource(ResourceId());
+
+    const auto logThreshold = gContendedLockWaitLogThresholdMillis.load();
+    if (MONGO_unlikely(logThreshold > 0)) {
+        const auto totalWaitTime = duration_cast<Milliseconds>(
+            Microseconds(int64_t(curTimeMicros64() - startOfTotalWaitTime)));
+        if (totalWaitTime >= Milliseconds(logThreshold)) {
+            LOGV2(5859500,
+                  "Contended lock wait",
+                  "resource"_attr = resId.toString(),
+                  "mode"_attr = modeName(mode),
+                  "waitTime"_attr = totalWaitTime,
+                  "opId"_attr = opCtx ? opCtx->getOpID() : 0,
+                  "client"_attr = opCtx ? opCtx->getClient()->desc() : std::string());
+        }
+    }
 }
 
 void LockerImpl::getFlowControlTicket(OperationContext* opCtx, LockMode lockMode) {
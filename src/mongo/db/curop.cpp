@@ -425,6 +425,13 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
         oplogGetMoreStats.recordMillis(executionTimeMillis);
     }
 
+    // Gets the time spent blocked on prepare conflicts. This is recorded before deciding whether
+    // to log or profile, since the profile filter, the slow query log and the profiler all read it.
+    auto prepareConflictDurationMicros =
+        PrepareConflictTracker::get(opCtx).getPrepareConflictDuration();
+    _debug.prepareConflictDurationMillis =
+        duration_cast<Milliseconds>(prepareConflictDurationMicros);
+
     bool shouldLogSlowOp, shouldProfileAtLevel1;
 
     if (auto filter =
@@ -485,12 +492,6 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
             }
         }
 
-        // Gets the time spent blocked on prepare conflicts.
-        auto prepareConflictDurationMicros =
-            PrepareConflictTracker::get(opCtx).getPrepareConflictDuration();
-        _debug.prepareConflictDurationMillis =
-            duration_cast<Milliseconds>(prepareConflictDurationMicros);
-
         auto operationMetricsPtr = [&]() -> ResourceConsumption::OperationMetrics* {
             auto& metricsCollector = ResourceConsumption::MetricsCollector::get(opCtx);
             if (metricsCollector.hasCollectedMetrics()) {
@@ -704,6 +705,10 @@ void CurOp::reportState(OperationContext* opCtx, BSONObjBuilder* builder, bool t
     if (auto n = _debug.additiveMetrics.writeConflicts.load(); n > 0) {
         builder->append("writeConflicts", n);
     }
+    if (auto d = PrepareConflictTracker::get(opCtx).getPrepareConflictDuration();
+        d > Microseconds::zero()) {
+        builder->append("prepareConflictDurationMillis", durationCount<Milliseconds>(d));
+    }
 
     builder->append("numYields", _numYields.load());
 
@@ -1005,6 +1010,10 @@ void OpDebug::append(OperationContext* opCtx,
     OPDEBUG_APPEND_OPTIONAL(b, "keysDeleted", additiveMetrics.keysDeleted);
     OPDEBUG_APPEND_ATOMIC(b, "prepareReadConflicts", additiveMetrics.prepareReadConflicts);
     OPDEBUG_APPEND_ATOMIC(b, "writeConflicts", additiveMetrics.writeConflicts);
+    if (prepareConflictDurationMillis > Milliseconds::zero()) {
+        b.appendNumber("prepareConflictDurationMillis",
+                       durationCount<Milliseconds>(prepareConflictDurationMillis));
+    }
 
     OPDEBUG_APPEND_OPTIONAL(b, "dataThroughputLastSecond", dataThroughputLastSecond);
     OPDEBUG_APPEND_OPTIONAL(b, "dataThroughputAverage", dataThroughputAverage);
@@ -1263,6 +1272,12 @@ std::function<BSONObj(ProfileFilter::Args)> OpDebug::appendStaged(StringSet requ
     addIfNeeded("writeConflicts", [](auto field, auto args, auto& b) {
         OPDEBUG_APPEND_ATOMIC(b, field, args.op.additiveMetrics.writeConflicts);
     });
+    addIfNeeded("prepareConflictDurationMillis", [](auto field, auto args, auto& b) {
+        if (args.op.prepareConflictDurationMillis > Milliseconds::zero()) {
+            b.appendNumber(field,
+                           durationCount<Milliseconds>(args.op.prepareConflictDurationMillis));
+        }
+    });
 
     addIfNeeded("dataThroughputLastSecond", [](auto field, auto args, auto& b) {
         OPDEBUG_APPEND_OPTIONAL(b, field, args.op.dataThroughputLastSecond);
@@ -33,6 +33,7 @@
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/curop.h"
+#include "mongo/db/prepare_conflict_tracker.h"
 #include "mongo/db/query/query_test_service_context.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/tick_source_mock.h"
@@ -242,6 +243,56 @@ TEST(CurOpTest, ShouldNotReportFailpointMsgIfNotSet) {
     ASSERT_FALSE(bsonObj.hasField("failpointMsg"));
 }
 
+TEST(CurOpTest, ShouldReportPrepareConflictDurationOnlyOnceBlocked) {
+    QueryTestServiceContext serviceContext;
+    auto tickSourceMock = std::make_unique<TickSourceMock<Microseconds>>();
+    auto tickSource = tickSourceMock.get();
+    serviceContext.getServiceContext()->setTickSource(std::move(tickSourceMock));
+    tickSource->advance(Milliseconds{100});
+
+    auto opCtx = serviceContext.makeOperationContext();
+    auto curop = CurOp::get(*opCtx);
+
+    auto reportState = [&] {
+        BSONObjBuilder builder;
+        stdx::lock_guard<Client> lk(*opCtx->getClient());
+        curop->reportState(opCtx.get(), &builder);
+        return builder.obj();
+    };
+
+    ASSERT_FALSE(reportState().hasField("prepareConflictDurationMillis"));
+
+    auto& tracker = PrepareConflictTracker::get(opCtx.get());
+    tracker.beginPrepareConflict(opCtx.get());
+    tickSource->advance(Milliseconds{15});
+    tracker.endPrepareConflict(opCtx.get());
+
+    ASSERT_EQ(15, reportState()["prepareConflictDurationMillis"].numberLong());
+}
+
+TEST(CurOpTest, AppendReportsRecordedPrepareConflictDuration) {
+    QueryTestServiceContext serviceContext;
+    auto opCtx = serviceContext.makeOperationContext();
+    SingleThreadedLockStats ls;
+
+    auto curop = CurOp::get(*opCtx);
+    curop->setGenericOpRequestDetails(
+        opCtx.get(), NamespaceString("myDb.coll"), nullptr, BSON("a" << 3), NetworkOp::dbQuery);
+    OpDebug& od = curop->debug();
+
+    auto append = [&] {
+        BSONObjBuilder builder;
+        od.append(opCtx.get(), ls, {}, builder);
+        return builder.obj();
+    };
+
+    ASSERT_FALSE(append().hasField("prepareConflictDurationMillis"));
+
+    // The profiler entry reports the duration recorded when the operation completed.
+    od.prepareConflictDurationMillis = Milliseconds{15};
+    ASSERT_EQ(15, append()["prepareConflictDurationMillis"].numberLong());
+}
+
 TEST(CurOpTest, ElapsedTimeReflectsTickSource) {
     QueryTestServiceContext serviceContext;
 
@@ -96,6 +96,9 @@ public:
     /**
      * Destroys cursors that have been inactive for too long.
      *
+     * Scans every cursor, but holds only one partition's lock at a time and disposes of the expired
+     * cursors after releasing it, so a pin or unpin waits at most for the scan of one partition.
+     *
      * Returns the number of cursors that were timed out.
      */
     std::size_t timeoutCursors(OperationContext* opCtx, Date_t now);
@@ -31,6 +31,7 @@
 
 #include "mongo/bson/util/bsoncolumn.h"
 #include "mongo/db/exec/bucket_unpacker.h"
+#include "mongo/db/matcher/expression.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
 
 namespace mongo {
@@ -46,6 +47,12 @@ public:
                          const BSONElement& metaValue,
                          bool includeTimeField,
                          bool includeMetaField) = 0;
+
+    // Advances to the next measurement and fills 'row' with its timestamp followed by one element
+    // per column added with 'addField()', in the order the columns were added. A missing value is
+    // represented by EOO. Returns true if there are more measurements to unpack.
+    virtual bool getNextRow(std::vector<BSONElement>* row) = 0;
+
     virtual void extractSingleMeasurement(MutableDocument& measurement,
                                           int j,
                                           const BucketSpec& spec,
@@ -90,6 +97,7 @@ public:
                  const BSONElement& metaValue,
                  bool includeTimeField,
                  bool includeMetaField) override;
+    bool getNextRow(std::vector<BSONElement>* row) override;
     void extractSingleMeasurement(MutableDocument& measurement,
                                   int j,
                                   const BucketSpec& spec,
@@ -174,6 +182,24 @@ bool BucketUnpackerV1::getNext(MutableDocument& measurement,
     return _timeFieldIter.more();
 }
 
+bool BucketUnpackerV1::getNextRow(std::vector<BSONElement>* row) {
+    auto&& timeElem = _timeFieldIter.next();
+    row->clear();
+    row->push_back(timeElem);
+
+    auto& currentIdx = timeElem.fieldNameStringData();
+    for (auto&& [colName, colIter] : _fieldIters) {
+        if (auto&& elem = *colIter; colIter.more() && elem.fieldNameStringData() == currentIdx) {
+            row->push_back(elem);
+            colIter.advance(elem);
+        } else {
+            row->emplace_back();
+        }
+    }
+
+    return _timeFieldIter.more();
+}
+
 void BucketUnpackerV1::extractSingleMeasurement(MutableDocument& measurement,
                                                 int j,
                                                 const BucketSpec& spec,
@@ -214,6 +240,7 @@ public:
                  const BSONElement& metaValue,
                  bool includeTimeField,
                  bool includeMetaField) override;
+    bool getNextRow(std::vector<BSONElement>* row) override;
     void extractSingleMeasurement(MutableDocument& measurement,
                                   int j,
                                   const BucketSpec& spec,
@@ -279,6 +306,16 @@ bool BucketUnpackerV2::getNext(MutableDocument& measurement,
     return _timeColumn.it != _timeColumn.column.end();
 }
 
+bool BucketUnpackerV2::getNextRow(std::vector<BSONElement>* row) {
+    row->clear();
+    row->push_back(*(_timeColumn.it++));
+    for (auto& fieldColumn : _fieldColumns) {
+        row->push_back(*(fieldColumn.it++));
+    }
+
+    return _timeColumn.it != _timeColumn.column.end();
+}
+
 void BucketUnpackerV2::extractSingleMeasurement(MutableDocument& measurement,
                                                 int j,
                                                 const BucketSpec& spec,
@@ -356,6 +393,65 @@ Document BucketUnpacker::getNext() {
     return measurement.freeze();
 }
 
+boost::optional<Document> BucketUnpacker::getNextMatching() {
+    tassert(5346515, "'getNextMatching()' requires an event filter", _eventFilter);
+    tassert(5346516, "'getNextMatching()' requires the bucket to be owned", _bucket.isOwned());
+    tassert(5346517,
+            "'getNextMatching()' was called after the bucket has been exhausted",
+            hasNext());
+
+    while (_hasNext) {
+        _hasNext = _unpackingImpl->getNextRow(&_row);
+        if (!rowMatchesEventFilter()) {
+            continue;
+        }
+
+        auto measurement = MutableDocument{};
+        if (_includeTimeField) {
+            measurement.addField(_spec.timeField, Value{_row[0]});
+        }
+
+        // Includes metaField when we're instructed to do so and metaField value exists.
+        if (_includeMetaField && _metaValue) {
+            measurement.addField(*_spec.metaField, Value{_metaValue});
+        }
+
+        for (size_t i = 0; i < _rowColumns.size(); ++i) {
+            if (const auto& elem = _row[i + 1]; _rowColumns[i].materialize && !elem.eoo()) {
+                measurement.addField(_rowColumns[i].name, Value{elem});
+            }
+        }
+
+        // Add computed meta projections.
+        for (auto&& name : _spec.computedMetaProjFields) {
+            measurement.addField(name, Value{_computedMetaProjections[name]});
+        }
+
+        return measurement.freeze();
+    }
+
+    return boost::none;
+}
+
+bool BucketUnpacker::rowMatchesEventFilter() const {
+    // Only assemble the fields the filter depends on. Data columns of V1 buckets are keyed by row
+    // index, so every element is renamed to the name of its column.
+    BSONObjBuilder bob;
+    if (_eventFilterFields.count(_spec.timeField)) {
+        bob.appendAs(_row[0], _spec.timeField);
+    }
+    if (_spec.metaField && _metaValue && _eventFilterFields.count(*_spec.metaField)) {
+        bob.appendAs(_metaValue, *_spec.metaField);
+    }
+    for (size_t i = 0; i < _rowColumns.size(); ++i) {
+        if (const auto& elem = _row[i + 1]; _rowColumns[i].filter && !elem.eoo()) {
+            bob.appendAs(elem, _rowColumns[i].name);
+        }
+    }
+
+    return _eventFilter->matchesBSON(bob.done());
+}
+
 Document BucketUnpacker::extractSingleMeasurement(int j) {
     tassert(5422101,
             "'extractSingleMeasurment' expects j to be greater than or equal to zero and less than "
@@ -437,6 +533,7 @@ void BucketUnpacker::reset(BSONObj&& bucket) {
 
     // Walk the data region of the bucket, and decide if an iterator should be set up based on the
     // include or exclude case.
+    _rowColumns.clear();
     for (auto&& elem : dataRegion) {
         auto& colName = elem.fieldNameStringData();
         if (colName == _spec.timeField) {
@@ -446,9 +543,20 @@ void BucketUnpacker::reset(BSONObj&& bucket) {
         }
 
         // Includes a field when '_unpackerBehavior' is 'kInclude' and it's found in 'fieldSet' or
-        // _unpackerBehavior is 'kExclude' and it's not found in 'fieldSet'.
-        if (determineIncludeField(colName, _unpackerBehavior, _spec)) {
+        // _unpackerBehavior is 'kExclude' and it's not found in 'fieldSet'. Fields the event filter
+        // depends on are unpacked as well, but only materialized if they are included.
+        auto materialize = determineIncludeField(colName, _unpackerBehavior, _spec);
+        if (!_eventFilter) {
+            if (materialize) {
+                _unpackingImpl->addField(elem);
+            }
+            continue;
+        }
+
+        auto filter = _eventFilterFields.count(colName.toString()) > 0;
+        if (materialize || filter) {
             _unpackingImpl->addField(elem);
+            _rowColumns.push_back({colName, materialize, filter});
         }
     }
 
@@ -503,6 +611,12 @@ void BucketUnpacker::setBucketSpecAndBehavior(BucketSpec&& bucketSpec, Behavior
     _spec = std::move(bucketSpec);
 }
 
+void BucketUnpacker::setEventFilter(const MatchExpression* filter,
+                                    std::set<std::string> filterFields) {
+    _eventFilter = filter;
+    _eventFilterFields = std::move(filterFields);
+}
+
 const std::set<StringData> BucketUnpacker::reservedBucketFieldNames = {
     timeseries::kBucketIdFieldName,
     timeseries::kBucketDataFieldName,
@@ -31,11 +31,14 @@
 
 #include <algorithm>
 #include <set>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/exec/document_value/document.h"
 
 namespace mongo {
+class MatchExpression;
+
 /**
  * Carries parameters for unpacking a bucket.
  */
@@ -58,6 +61,11 @@ struct BucketSpec {
 
 /**
  * BucketUnpacker will unpack bucket fields for metadata and the provided fields.
+ *
+ * An unpacker holds iteration state for the single bucket it was last reset to and is driven by
+ * the thread executing the owning plan; it is not safe to share across threads. Scans that need
+ * more parallelism get it from sharding the time-series collection, since each shard unpacks its
+ * own buckets.
  */
 class BucketUnpacker {
 public:
@@ -93,6 +101,15 @@ public:
      */
     Document extractSingleMeasurement(int j);
 
+    /**
+     * This method will continue to materialize Documents until it finds a measurement which
+     * satisfies the event filter given to 'setEventFilter()', or returns boost::none if the
+     * bucket is exhausted first. The event filter is evaluated against only the fields it depends
+     * on, which are read directly off the bucket's columns, so measurements which are filtered out
+     * are never materialized. A precondition of this method is that 'hasNext()' must be true.
+     */
+    boost::optional<Document> getNextMatching();
+
     /**
      * Returns true if there is more data to fetch, is the precondition for 'getNext'.
      */
@@ -142,9 +159,38 @@ public:
     // Add computed meta projection names to the bucket specification.
     void addComputedMetaProjFields(const std::vector<StringData>& computedFieldNames);
 
+    /**
+     * Sets the filter used by 'getNextMatching()'. 'filterFields' holds the top-level field names
+     * 'filter' depends on; these columns are unpacked even if they are not included in the
+     * materialized measurements. 'filter' is not owned and must outlive this unpacker. Takes effect
+     * on the next call to 'reset()'.
+     */
+    void setEventFilter(const MatchExpression* filter, std::set<std::string> filterFields);
+
+    const MatchExpression* eventFilter() const {
+        return _eventFilter;
+    }
+
     class UnpackingImpl;
 
 private:
+    // Describes a column which was set up for unpacking during the reset phase when an event
+    // filter is present.
+    struct RowColumn {
+        StringData name;
+
+        // Whether the column should be materialized in measurements.
+        bool materialize;
+
+        // Whether the event filter depends on the column.
+        bool filter;
+    };
+
+    /**
+     * Returns true if the measurement currently held in '_row' satisfies the event filter.
+     */
+    bool rowMatchesEventFilter() const;
+
     BucketSpec _spec;
     Behavior _unpackerBehavior;
 
@@ -173,6 +219,16 @@ private:
 
     // The number of measurements in the bucket.
     int32_t _numberOfMeasurements = 0;
+
+    // An optional filter on the measurements, and the top-level fields it depends on.
+    const MatchExpression* _eventFilter = nullptr;
+    std::set<std::string> _eventFilterFields;
+
+    // The columns set up for unpacking in the current bucket, populated only if there is an event
+    // filter, and the values of the current measurement. '_row' holds the timestamp followed by one
+    // element per entry in '_rowColumns', with EOO representing a missing value.
+    std::vector<RowColumn> _rowColumns;
+    std::vector<BSONElement> _row;
 };
 
 /**
@@ -33,6 +33,8 @@
 #include "mongo/bson/util/bsoncolumnbuilder.h"
 #include "mongo/db/exec/bucket_unpacker.h"
 #include "mongo/db/exec/document_value/document_value_test_util.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/unittest/unittest.h"
 
 namespace mongo {
@@ -215,6 +217,38 @@ TEST_F(BucketUnpackerTest, ExcludeASingleField) {
     test(compress(bucket, "time"_sd));
 }
 
+TEST_F(BucketUnpackerTest, GetNextMatchingEvaluatesEventFilterOnUnmaterializedField) {
+    std::set<std::string> fields{"_id", "a"};
+
+    auto bucket = fromjson(
+        "{control: {'version': 1}, meta: {'m1': 999, 'm2': 9999}, data: {_id: {'0':1, '1':2, "
+        "'2':3}, time: {'0':1, '1':2, '2':3}, a:{'0':1, '1':2, '2':3}, b:{'1':1, '2':0}}}");
+
+    auto expCtx = make_intrusive<ExpressionContextForTest>();
+    auto filter = uassertStatusOK(MatchExpressionParser::parse(fromjson("{b: 1}"), expCtx));
+
+    auto test = [&](BSONObj bucket) {
+        auto spec = BucketSpec{kUserDefinedTimeName.toString(), boost::none, fields};
+        BucketUnpacker unpacker{std::move(spec), BucketUnpacker::Behavior::kInclude};
+        unpacker.setEventFilter(filter.get(), {"b"});
+        unpacker.reset(std::move(bucket));
+
+        // Only the second measurement matches, and 'b' is not materialized since it is not
+        // included.
+        ASSERT_TRUE(unpacker.hasNext());
+        auto measurement = unpacker.getNextMatching();
+        ASSERT_TRUE(measurement);
+        ASSERT_DOCUMENT_EQ(*measurement, Document{fromjson("{_id: 2, a: 2}")});
+
+        ASSERT_TRUE(unpacker.hasNext());
+        ASSERT_FALSE(unpacker.getNextMatching());
+        ASSERT_FALSE(unpacker.hasNext());
+    };
+
+    test(bucket);
+    test(compress(bucket, "time"_sd));
+}
+
 TEST_F(BucketUnpackerTest, EmptyIncludeGetsEmptyMeasurements) {
     std::set<std::string> fields{};
 
@@ -179,6 +179,10 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         }
 
         if (!record) {
+            // Records are fetched synchronously; a cache miss stalls this thread until WiredTiger
+            // reads the page in. There is no read-ahead: the storage engine exposes no prefetch
+            // hook, and warming pages from a helper thread would need its own session and snapshot
+            // with yields coordinated against this cursor's.
             record = _cursor->next();
         }
     } catch (const WriteConflictException&) {
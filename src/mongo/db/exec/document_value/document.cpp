@@ -457,6 +457,10 @@ void Document::toBson(BSONObjBuilder* builder, size_t recursionLevel) const {
                           << BSONDepth::getMaxAllowableDepth() << " levels of nesting",
             recursionLevel <= BSONDepth::getMaxAllowableDepth());
 
+    // Fields which were never pulled into the cache are spliced verbatim from the backing BSON, so
+    // only fields that were looked up or modified pay for re-serialization. A cached field cannot
+    // take the same shortcut: MutableDocument may overwrite it in place through a MutableValue
+    // without its kind changing, so kCached does not guarantee the BSON image is still accurate.
     for (DocumentStorageIterator it = storage().iterator(); !it.atEnd(); it.advance()) {
         if (auto cached = it.cachedValue()) {
             cached->val.addToBsonObj(builder, cached->nameSD(), recursionLevel);
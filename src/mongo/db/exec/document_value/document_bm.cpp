@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/exec/document_value/document.h"
+
+namespace mongo {
+namespace {
+
+BSONObj buildFlatObj(int numFields) {
+    BSONObjBuilder builder;
+    for (int i = 0; i < numFields; ++i) {
+        builder.append("field" + std::to_string(i), i);
+    }
+    return builder.obj();
+}
+
+std::string lastFieldName(int numFields) {
+    return "field" + std::to_string(numFields - 1);
+}
+
+// Looks up the last field of a freshly wrapped BSONObj, which walks the backing BSON to find it.
+void BM_DocumentGetFieldFromBson(benchmark::State& state) {
+    auto obj = buildFlatObj(state.range(0));
+    auto name = lastFieldName(state.range(0));
+    for (auto _ : state) {
+        Document doc(obj);
+        benchmark::DoNotOptimize(doc[name]);
+    }
+}
+
+// Looks up the last field of a Document built field by field, so there is no backing BSON and the
+// lookup exercises the linear scan or hash table of the DocumentStorage.
+void BM_DocumentGetFieldCached(benchmark::State& state) {
+    auto name = lastFieldName(state.range(0));
+    MutableDocument md;
+    for (int i = 0; i < state.range(0); ++i) {
+        md.addField("field" + std::to_string(i), Value(i));
+    }
+    Document doc = md.freeze();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(doc[name]);
+    }
+}
+
+// Adds a field to a BSON-backed Document, forcing a copy of its storage.
+void BM_MutableDocumentAddField(benchmark::State& state) {
+    Document doc(buildFlatObj(state.range(0)));
+    for (auto _ : state) {
+        MutableDocument md(doc);
+        md.addField("newField", Value(1));
+        benchmark::DoNotOptimize(md.freeze());
+    }
+}
+
+// Overwrites an existing field of a BSON-backed Document.
+void BM_MutableDocumentSetField(benchmark::State& state) {
+    auto name = lastFieldName(state.range(0));
+    Document doc(buildFlatObj(state.range(0)));
+    for (auto _ : state) {
+        MutableDocument md(doc);
+        md.setField(name, Value(-1));
+        benchmark::DoNotOptimize(md.freeze());
+    }
+}
+
+BENCHMARK(BM_DocumentGetFieldFromBson)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_DocumentGetFieldCached)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_MutableDocumentAddField)->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_MutableDocumentSetField)->RangeMultiplier(4)->Range(1, 256);
+
+}  // namespace
+}  // namespace mongo
@@ -573,6 +573,11 @@ private:
     //
     //
     // When the buffer grows, the hash table moves to the new end.
+    //
+    // The buffer is owned by this storage alone and lives exactly as long as it. Documents are
+    // reference counted and freely escape the stage that created them (into $group or $sort
+    // state, caches, cursors' stashed results...), so the buffer can't be carved out of a region
+    // released at the end of a batch.
     union {
         char* _cache;
         ValueElement* _firstElement;
@@ -32,6 +32,7 @@
 #include "mongo/db/exec/geo_near.h"
 
 #include "mongo/logv2/log.h"
+#include <cmath>
 #include <memory>
 #include <vector>
 
@@ -874,12 +875,22 @@ std::unique_ptr<NearStage::CoveredInterval> GeoNear2DSphereStage::nextInterval(
 
     if (!_specificStats.intervalStats.empty()) {
         const IntervalStats& lastIntervalStats = _specificStats.intervalStats.back();
+        const long long numResults = lastIntervalStats.numResultsReturned;
 
-        // TODO: Generally we want small numbers of results fast, then larger numbers later
-        if (lastIntervalStats.numResultsReturned < 300)
+        if (numResults == 0) {
             _boundsIncrement *= 2;
-        else if (lastIntervalStats.numResultsReturned > 600)
-            _boundsIncrement /= 2;
+        } else if (numResults < 300 || numResults > 600) {
+            // Size the next annulus so that it would hold about 450 results at the density seen in
+            // the last one, rather than only doubling or halving the width. In dense areas this
+            // avoids many thin rings, and in sparse areas many rings with few results each. The
+            // change is capped at a factor of four per interval since the data may not be uniform.
+            const double inner = _currBounds.getInner();
+            const double outer = _currBounds.getOuter();
+            const double nextArea = (outer * outer - inner * inner) * 450 / numResults;
+            const double increment = std::sqrt(outer * outer + nextArea) - outer;
+            _boundsIncrement =
+                std::max(_boundsIncrement / 4, std::min(_boundsIncrement * 4, increment));
+        }
     }
 
     invariant(_boundsIncrement > 0.0);
@@ -88,6 +88,10 @@ struct IndexScanParams {
  * Stage scans over an index from startKey to endKey, returning results that pass the provided
  * filter.  Internally dedups on RecordId.
  *
+ * When scanning with bounds, the IndexBoundsChecker seeks past keys that fall outside the bounds of
+ * a field instead of reading them. For example, with bounds {a: [MinKey, MaxKey], b: [5, 5]} the
+ * scan jumps from one value of 'a' to the next, which is effectively a skip scan.
+ *
  * Sub-stage preconditions: None.  Is a leaf and consumes no stage data.
  */
 class IndexScan final : public RequiresIndexStage {
@@ -151,6 +151,9 @@ private:
      * Calls work on each child plan in a round-robin fashion. We stop when any plan hits EOF
      * or returns 'numResults' results.
      *
+     * Interleaving the candidates keeps one slow candidate from consuming the whole trial budget
+     * before the others start.
+     *
      * Returns true if we need to keep working the plans and false otherwise.
      */
     bool workAllPlans(size_t numResults, PlanYieldPolicy* yieldPolicy);
@@ -243,6 +243,7 @@ ProjectionStageCovered::ProjectionStageCovered(ExpressionContext* expCtx,
             // If we are including this key field store its field name.
             _keyFieldNames.push_back(*fieldIt);
             _includeKey.push_back(true);
+            ++_numIncludedKeyFields;
         }
     }
 }
@@ -254,14 +255,17 @@ void ProjectionStageCovered::transform(WorkingSetMember* member) const {
     invariant(1 == member->keyData.size());
     size_t keyIndex = 0;
 
-    // Look at every key element...
+    // Look at every key element until all of the included ones have been appended. Trailing key
+    // fields which are not part of the projection need not be visited.
+    auto nFieldsNeeded = _numIncludedKeyFields;
     BSONObjIterator keyIterator(member->keyData[0].keyData);
-    while (keyIterator.more()) {
+    while (nFieldsNeeded > 0 && keyIterator.more()) {
         BSONElement elt = keyIterator.next();
         // If we're supposed to include it...
         if (_includeKey[keyIndex]) {
             // Do so.
             bob.appendAs(elt, _keyFieldNames[keyIndex]);
+            --nFieldsNeeded;
         }
         ++keyIndex;
     }
@@ -144,6 +144,9 @@ private:
 
     // If the i-th entry of _includeKey is true this is the field name for the i-th key field.
     std::vector<StringData> _keyFieldNames;
+
+    // The number of true entries in _includeKey.
+    size_t _numIncludedKeyFields = 0;
 };
 
 /**
@@ -97,22 +97,22 @@ PlanStage::StageState SampleFromTimeseriesBucket::doWork(WorkingSetID* out) {
                 ++_nSampledSoFar;
                 _worksSinceLastAdvanced = 0;
                 *out = id;
-            } else {
-                ++_specificStats.dupsDropped;
-                ++_worksSinceLastAdvanced;
-                _ws.free(id);
-                return PlanStage::NEED_TIME;
+                return status;
             }
+            ++_specificStats.dupsDropped;
         } else {
             ++_specificStats.nBucketsDiscarded;
-            ++_worksSinceLastAdvanced;
-            _ws.free(id);
-            return PlanStage::NEED_TIME;
         }
+
+        // This was a miss, either a duplicate or an index past the end of the bucket. Give up once
+        // too many of them happen in a row rather than spinning over sparse buckets indefinitely.
+        ++_worksSinceLastAdvanced;
+        _ws.free(id);
         uassert(5521504,
                 str::stream() << kStageType << " could not find a non-duplicate measurement after "
                               << _worksSinceLastAdvanced << " attempts",
                 _worksSinceLastAdvanced < _maxConsecutiveAttempts);
+        return PlanStage::NEED_TIME;
     } else if (PlanStage::NEED_YIELD == status) {
         *out = id;
     }
@@ -52,6 +52,8 @@ public:
      *  performing the ARHASH algorithm. A miss may happen either when we sample a duplicate, or the
      *  index 'j' selected by the PRNG exceeds the number of measurements in the bucket. If we miss
      *  enough times in a row, we throw an exception that terminates the execution of the query.
+     *  The $sample optimization passes a limit just above the TrialStage's presample size, so the
+     *  trial that picks between this plan and the top-k sort plan never reaches it.
      *  - 'bucketMaxCount' is the maximum number of measurements allowed in a bucket, which can be
      *  configured via a server parameter.
      */
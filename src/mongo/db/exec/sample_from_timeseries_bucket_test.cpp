@@ -0,0 +1,105 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/exec/queued_data_stage.h"
+#include "mongo/db/exec/sample_from_timeseries_bucket.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/service_context_d_test_fixture.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss("db.dummy");
+
+class SampleFromTimeseriesBucketTest : public ServiceContextMongoDTest {
+public:
+    SampleFromTimeseriesBucketTest() : _opCtx(makeOperationContext()) {
+        _expCtx = make_intrusive<ExpressionContext>(_opCtx.get(), nullptr, kNss);
+    }
+
+    /**
+     * Builds a stage sampling from a child that returns the same single-measurement bucket
+     * 'numBuckets' times.
+     */
+    std::unique_ptr<SampleFromTimeseriesBucket> makeStage(int numBuckets,
+                                                          int maxConsecutiveAttempts,
+                                                          long long sampleSize) {
+        auto bucket = BSON("_id" << OID::gen() << "control" << BSON("version" << 1) << "data"
+                                 << BSON("time" << BSON("0" << Date_t::now())));
+
+        auto child = std::make_unique<QueuedDataStage>(_expCtx.get(), &_ws);
+        for (int i = 0; i < numBuckets; ++i) {
+            auto id = _ws.allocate();
+            auto member = _ws.get(id);
+            member->doc = {SnapshotId(), Document{bucket}};
+            member->transitionToOwnedObj();
+            child->pushBack(id);
+        }
+
+        // With 'bucketMaxCount' of one, every draw picks the bucket's only measurement, so each
+        // draw after the first is a duplicate.
+        return std::make_unique<SampleFromTimeseriesBucket>(
+            _expCtx.get(),
+            &_ws,
+            std::move(child),
+            BucketUnpacker{BucketSpec{"time", boost::none, {}}, BucketUnpacker::Behavior::kExclude},
+            maxConsecutiveAttempts,
+            sampleSize,
+            1 /* bucketMaxCount */);
+    }
+
+private:
+    ServiceContext::UniqueOperationContext _opCtx;
+    boost::intrusive_ptr<ExpressionContext> _expCtx;
+    WorkingSet _ws;
+};
+
+TEST_F(SampleFromTimeseriesBucketTest, ThrowsAfterTooManyConsecutiveMisses) {
+    auto stage = makeStage(10 /* numBuckets */, 3 /* maxConsecutiveAttempts */, 5 /* sampleSize */);
+
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    ASSERT_EQ(PlanStage::ADVANCED, stage->work(&id));
+
+    // Two misses in a row stay below the limit; the third reaches it.
+    ASSERT_EQ(PlanStage::NEED_TIME, stage->work(&id));
+    ASSERT_EQ(PlanStage::NEED_TIME, stage->work(&id));
+    ASSERT_THROWS_CODE(stage->work(&id), AssertionException, 5521504);
+
+    auto stats = static_cast<const SampleFromTimeseriesBucketStats*>(stage->getSpecificStats());
+    ASSERT_EQ(4U, stats->dupsTested);
+    ASSERT_EQ(3U, stats->dupsDropped);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -572,6 +572,22 @@ vm::CodeFragment EFunction::compileDirect(CompileCtx& ctx) const {
         }
         vm::CodeFragment code;
 
+        // Field lookups by a constant name are by far the most common kind of getField, so they
+        // are compiled into a single instruction carrying the field name as an immediate.
+        if (_name == "getField"_sd) {
+            if (auto fieldConst = dynamic_cast<const EConstant*>(_nodes[1].get())) {
+                auto [fieldTag, fieldVal] = fieldConst->getConstant();
+                if (value::isString(fieldTag)) {
+                    auto fieldName = value::getStringView(fieldTag, fieldVal);
+                    if (fieldName.size() <= vm::CodeFragment::kMaxImmFieldNameSize) {
+                        code.append(_nodes[0]->compileDirect(ctx));
+                        code.appendGetFieldImm(fieldName);
+                        return code;
+                    }
+                }
+            }
+        }
+
         if (it->second.aggregate) {
             uassert(4822846,
                     str::stream() << "aggregate function call: " << _name
@@ -0,0 +1,140 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/sbe/expression_test_base.h"
+#include "mongo/db/exec/sbe/values/bson.h"
+
+namespace mongo::sbe {
+
+class SBEGetFieldTest : public EExpressionTestFixture {
+protected:
+    using TypedValue = std::pair<value::TypeTags, value::Value>;
+
+    /**
+     * Compile and run expression 'getField(obj, fieldName)' and return its result. If
+     * 'constantFieldName' is true, then the field name is passed as a constant, and otherwise it
+     * is read from a slot.
+     * NOTE: The return value of this function is owned by the caller.
+     */
+    TypedValue runGetField(TypedValue obj, StringData fieldName, bool constantFieldName) {
+        value::ViewOfValueAccessor objAccessor;
+        auto objSlot = bindAccessor(&objAccessor);
+        objAccessor.reset(obj.first, obj.second);
+
+        auto [nameTag, nameVal] = value::makeNewString(fieldName);
+        value::OwnedValueAccessor nameAccessor;
+        std::unique_ptr<EExpression> nameExpr;
+        if (constantFieldName) {
+            nameExpr = makeE<EConstant>(nameTag, nameVal);
+        } else {
+            nameAccessor.reset(nameTag, nameVal);
+            nameExpr = makeE<EVariable>(bindAccessor(&nameAccessor));
+        }
+
+        auto getFieldExpr = makeE<EFunction>(
+            "getField", makeEs(makeE<EVariable>(objSlot), std::move(nameExpr)));
+        auto compiledExpr = compileExpression(*getFieldExpr);
+
+        auto [tag, val] = runCompiledExpression(compiledExpr.get());
+        return value::copyValue(tag, val);
+    }
+
+    void runAndAssertGetField(const BSONObj& obj, StringData fieldName, BSONElement expected) {
+        auto [objTag, objVal] = value::copyValue(value::TypeTags::bsonObject,
+                                                 value::bitcastFrom<const char*>(obj.objdata()));
+        value::ValueGuard objGuard{objTag, objVal};
+
+        for (bool constantFieldName : {true, false}) {
+            auto [tag, val] = runGetField({objTag, objVal}, fieldName, constantFieldName);
+            value::ValueGuard guard{tag, val};
+
+            if (expected.eoo()) {
+                ASSERT_EQ(tag, value::TypeTags::Nothing);
+                continue;
+            }
+
+            auto [expectedTag, expectedVal] =
+                bson::convertFrom<true>(expected.rawdata(),
+                                        expected.rawdata() + expected.size(),
+                                        expected.fieldNameSize() - 1);
+            auto [compareTag, compareVal] = value::compareValue(tag, val, expectedTag, expectedVal);
+            ASSERT_EQ(compareTag, value::TypeTags::NumberInt32);
+            ASSERT_EQ(value::bitcastTo<int32_t>(compareVal), 0);
+        }
+    }
+};
+
+TEST_F(SBEGetFieldTest, GetFieldFromBsonObject) {
+    auto obj = BSON("a" << 1 << "b"
+                        << "str"
+                        << "c" << BSON("d" << 2));
+    runAndAssertGetField(obj, "a", obj["a"]);
+    runAndAssertGetField(obj, "b", obj["b"]);
+    runAndAssertGetField(obj, "c", obj["c"]);
+    runAndAssertGetField(obj, "d", BSONElement());
+    runAndAssertGetField(obj, "", BSONElement());
+}
+
+TEST_F(SBEGetFieldTest, GetFieldWithLongFieldName) {
+    // Field names which do not fit into an immediate operand must still be looked up correctly.
+    for (size_t size : {vm::CodeFragment::kMaxImmFieldNameSize,
+                        vm::CodeFragment::kMaxImmFieldNameSize + 1}) {
+        std::string fieldName(size, 'f');
+        auto obj = BSON("a" << 1 << fieldName << 2);
+        runAndAssertGetField(obj, fieldName, obj[fieldName]);
+    }
+}
+
+TEST_F(SBEGetFieldTest, GetFieldFromNonObjectReturnsNothing) {
+    for (bool constantFieldName : {true, false}) {
+        auto [tag, val] = runGetField(makeInt32(1), "a", constantFieldName);
+        value::ValueGuard guard{tag, val};
+        ASSERT_EQ(tag, value::TypeTags::Nothing);
+    }
+}
+
+TEST_F(SBEGetFieldTest, GetFieldWithNonStringConstantReturnsNothing) {
+    auto obj = BSON("a" << 1);
+    auto [objTag, objVal] = value::copyValue(value::TypeTags::bsonObject,
+                                             value::bitcastFrom<const char*>(obj.objdata()));
+    value::ValueGuard objGuard{objTag, objVal};
+
+    value::ViewOfValueAccessor objAccessor;
+    auto objSlot = bindAccessor(&objAccessor);
+    objAccessor.reset(objTag, objVal);
+
+    auto getFieldExpr = makeE<EFunction>(
+        "getField",
+        makeEs(makeE<EVariable>(objSlot),
+               makeE<EConstant>(value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(1))));
+    auto compiledExpr = compileExpression(*getFieldExpr);
+    auto [tag, val] = runCompiledExpression(compiledExpr.get());
+    ASSERT_EQ(tag, value::TypeTags::Nothing);
+}
+}  // namespace mongo::sbe
@@ -37,6 +37,7 @@
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/stages/hash_join.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 
@@ -137,4 +138,48 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
     }
 }
 
+TEST_F(HashJoinStageTest, HashJoinOverMemoryBudgetTest) {
+    // Make every outer row fill the hash table, so that each one is joined in its own pass over
+    // the inner side.
+    auto defaultInternalQuerySBEHashJoinApproxMemoryUseInBytes =
+        internalQuerySBEHashJoinApproxMemoryUseInBytes.load();
+    internalQuerySBEHashJoinApproxMemoryUseInBytes.store(1);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEHashJoinApproxMemoryUseInBytes.store(
+            defaultInternalQuerySBEHashJoinApproxMemoryUseInBytes);
+    });
+
+    auto [outerCondSlot, outerStage] = generateVirtualScan(BSON_ARRAY(1 << 2 << 3 << 2));
+    auto [innerCondSlot, innerStage] = generateVirtualScan(BSON_ARRAY(2 << 3 << 4 << 2));
+    auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                      std::move(innerStage),
+                                      makeSV(outerCondSlot),
+                                      makeSV(),
+                                      makeSV(innerCondSlot),
+                                      makeSV(),
+                                      boost::none,
+                                      kEmptyPlanNodeId);
+
+    auto ctx = makeCompileCtx();
+    auto resultAccessors =
+        prepareTree(ctx.get(), stage.get(), makeSV(outerCondSlot, innerCondSlot));
+
+    std::multiset<std::pair<int32_t, int32_t>> results;
+    while (stage->getNext() == PlanState::ADVANCED) {
+        auto [outerTag, outerVal] = resultAccessors[0]->getViewOfValue();
+        auto [innerTag, innerVal] = resultAccessors[1]->getViewOfValue();
+        results.emplace(value::numericCast<int32_t>(outerTag, outerVal),
+                        value::numericCast<int32_t>(innerTag, innerVal));
+    }
+
+    // Every matching pair is produced exactly once, even though the outer side was split up.
+    std::multiset<std::pair<int32_t, int32_t>> expected{{2, 2}, {2, 2}, {2, 2}, {2, 2}, {3, 3}};
+    ASSERT(results == expected);
+
+    auto stats = static_cast<const HashJoinStats*>(stage->getSpecificStats());
+    ASSERT_EQ(stats->passes, 4);
+
+    stage->close();
+}
+
 }  // namespace mongo::sbe
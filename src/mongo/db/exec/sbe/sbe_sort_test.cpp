@@ -32,6 +32,7 @@
 
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/stages/sort.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace mongo::sbe {
 
@@ -68,4 +69,42 @@ TEST_F(SortStageTest, SortNumbersTest) {
     runTestMulti(2, inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
 }
 
+TEST_F(SortStageTest, SortNumbersDescendingOnKeyStringKeysTest) {
+    RAIIServerParameterControllerForTest controller(
+        "internalQuerySlotBasedExecutionSortUseKeyStringKeys", true);
+
+    auto [inputTag, inputVal] = stage_builder::makeValue(
+        BSON_ARRAY(BSON_ARRAY(12LL << "A") << BSON_ARRAY(2.5 << "B") << BSON_ARRAY(7 << "C")
+                                           << BSON_ARRAY(Decimal128(4) << "D")
+                                           << BSON_ARRAY("str" << "E")));
+    value::ValueGuard inputGuard{inputTag, inputVal};
+
+    // Strings sort after numbers, and the original key values of mixed numeric types are returned
+    // unchanged.
+    auto [expectedTag, expectedVal] = stage_builder::makeValue(
+        BSON_ARRAY(BSON_ARRAY("str" << "E") << BSON_ARRAY(12LL << "A") << BSON_ARRAY(7 << "C")
+                                            << BSON_ARRAY(Decimal128(4) << "D")
+                                            << BSON_ARRAY(2.5 << "B")));
+    value::ValueGuard expectedGuard{expectedTag, expectedVal};
+
+    auto makeStageFn = [](value::SlotVector scanSlots, std::unique_ptr<PlanStage> scanStage) {
+        // Create a SortStage that sorts by slot0 in descending order.
+        auto sortStage =
+            makeS<SortStage>(std::move(scanStage),
+                             makeSV(scanSlots[0]),
+                             std::vector<value::SortDirection>{value::SortDirection::Descending},
+                             makeSV(scanSlots[1]),
+                             std::numeric_limits<std::size_t>::max(),
+                             204857600,
+                             false,
+                             kEmptyPlanNodeId);
+
+        return std::make_pair(scanSlots, std::move(sortStage));
+    };
+
+    inputGuard.reset();
+    expectedGuard.reset();
+    runTestMulti(2, inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
+}
+
 }  // namespace mongo::sbe
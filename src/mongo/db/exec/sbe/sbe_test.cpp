@@ -466,4 +466,23 @@ TEST(SBESmallString, Length) {
         ASSERT_EQ(length, value::getStringLength(tag, val));
     }
 }
+
+TEST(SBESmallString, CopyOfShortBsonStringIsSmall) {
+    auto bsonObj = BSON("short"
+                        << "abc"
+                        << "long"
+                        << "not so small string");
+
+    auto [shortTag, shortVal] = value::copyValue(
+        value::TypeTags::bsonString, value::bitcastFrom<const char*>(bsonObj["short"].value()));
+    ASSERT_EQ(shortTag, value::TypeTags::StringSmall);
+    ASSERT_EQ("abc"_sd, value::getStringView(shortTag, shortVal));
+    value::releaseValue(shortTag, shortVal);
+
+    auto [longTag, longVal] = value::copyValue(
+        value::TypeTags::bsonString, value::bitcastFrom<const char*>(bsonObj["long"].value()));
+    ASSERT_EQ(longTag, value::TypeTags::StringBig);
+    ASSERT_EQ("not so small string"_sd, value::getStringView(longTag, longVal));
+    value::releaseValue(longTag, longVal);
+}
 }  // namespace mongo::sbe
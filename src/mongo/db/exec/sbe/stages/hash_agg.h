@@ -60,6 +60,12 @@ namespace sbe {
  * determining whether two group-by keys are equal. For instance, the plan may require us to do a
  * case-insensitive group on a string field.
  *
+ * If the estimated size of the hash table exceeds
+ * 'internalQuerySlotBasedExecutionHashAggApproxMemoryUseInBytesBeforeSpill', the query fails. This
+ * stage does not spill to disk: the SBE stage builders only create it for single-group
+ * aggregations inside expressions such as $concatArrays, while $group runs as DocumentSourceGroup,
+ * which spills through its own sorter.
+ *
  * Debug string representation:
  *
  *  group [<group by slots>] [slot_1 = expr_1, ..., slot_n = expr_n] [<seek slots>]? reopen?
@@ -106,7 +112,7 @@ private:
     // Memory tracking variables.
     const long long _approxMemoryUseInBytesBeforeSpill =
         internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
-    const int _memoryUseSampleRate = internalQuerySBEAggMemoryUseSampleRate.load();
+    const double _memoryUseSampleRate = internalQuerySBEAggMemoryUseSampleRate.load();
     // Used in collaboration with memoryUseSampleRatePercentage to determine whether we should
     // re-approximate memory usage.
     PseudoRandom _pseudoRandom = PseudoRandom(Date_t::now().asInt64());
@@ -143,9 +143,32 @@ void HashJoinStage::open(bool reOpen) {
     }
 
     _commonStats.opens++;
+    if (_outerOpened) {
+        // The previous open() did not get through the whole outer side.
+        _children[0]->close();
+        _outerOpened = false;
+    }
     _children[0]->open(reOpen);
-    // Insert the outer side into the hash table.
-    while (_children[0]->getNext() == PlanState::ADVANCED) {
+    _outerOpened = true;
+    buildHashTable();
+
+    _children[1]->open(reOpen);
+    _specificStats.passes++;
+}
+
+void HashJoinStage::buildHashTable() {
+    _ht->clear();
+    long long tableSizeBytes = 0;
+
+    // Insert the outer side into the hash table. At least one row is inserted in every pass, so
+    // that the join always makes progress.
+    while (tableSizeBytes < _approxMemoryUseInBytes) {
+        if (_children[0]->getNext() != PlanState::ADVANCED) {
+            _children[0]->close();
+            _outerOpened = false;
+            break;
+        }
+
         value::MaterializedRow key{_inOuterKeyAccessors.size()};
         value::MaterializedRow project{_inOuterProjectAccessors.size()};
 
@@ -163,12 +186,12 @@ void HashJoinStage::open(bool reOpen) {
             project.reset(idx++, true, tag, val);
         }
 
+        tableSizeBytes += key.memUsageForSorter() + project.memUsageForSorter();
         _ht->emplace(std::move(key), std::move(project));
     }
 
-    _children[0]->close();
-
-    _children[1]->open(reOpen);
+    _specificStats.maxTableSizeBytes = std::max(_specificStats.maxTableSizeBytes,
+                                                static_cast<uint64_t>(tableSizeBytes));
 
     _htIt = _ht->end();
     _htItEnd = _ht->end();
@@ -186,7 +209,19 @@ PlanState HashJoinStage::getNext() {
             auto state = _children[1]->getNext();
             if (state == PlanState::IS_EOF) {
                 // LEFT and OUTER joins should enumerate "non-returned" rows here.
-                return trackPlanState(state);
+                if (!_outerOpened) {
+                    return trackPlanState(state);
+                }
+
+                // The outer side did not fit into the hash table. Join its next part with another
+                // scan of the inner side.
+                buildHashTable();
+                if (_ht->empty()) {
+                    return trackPlanState(state);
+                }
+                _children[1]->open(true);
+                _specificStats.passes++;
+                continue;
             }
 
             // Copy keys in order to do the lookup.
@@ -212,18 +247,32 @@ void HashJoinStage::close() {
 
     trackClose();
     _children[1]->close();
+    if (_outerOpened) {
+        _children[0]->close();
+        _outerOpened = false;
+    }
     _ht = boost::none;
 }
 
 std::unique_ptr<PlanStageStats> HashJoinStage::getStats(bool includeDebugInfo) const {
     auto ret = std::make_unique<PlanStageStats>(_commonStats);
+    ret->specific = std::make_unique<HashJoinStats>(_specificStats);
+
+    if (includeDebugInfo) {
+        BSONObjBuilder bob;
+        bob.appendNumber("passes", static_cast<long long>(_specificStats.passes));
+        bob.appendNumber("maxTableSizeBytes",
+                         static_cast<long long>(_specificStats.maxTableSizeBytes));
+        ret->debugInfo = bob.obj();
+    }
+
     ret->children.emplace_back(_children[0]->getStats(includeDebugInfo));
     ret->children.emplace_back(_children[1]->getStats(includeDebugInfo));
     return ret;
 }
 
 const SpecificStats* HashJoinStage::getSpecificStats() const {
-    return nullptr;
+    return &_specificStats;
 }
 
 std::vector<DebugPrinter::Block> HashJoinStage::debugPrint() const {
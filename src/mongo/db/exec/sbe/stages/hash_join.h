@@ -33,6 +33,7 @@
 
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/vm/vm.h"
+#include "mongo/db/query/query_knobs_gen.h"
 
 namespace mongo::sbe {
 /**
@@ -51,6 +52,12 @@ namespace mongo::sbe {
  * for string equality. For example, this can be used to perform a case-insensitive join on string
  * values.
  *
+ * The hash table is bounded by the 'internalQuerySlotBasedExecutionHashJoinApproxMemoryUseInBytes'
+ * knob. When the outer side goes over it, the stage stops reading the outer side and joins the rows
+ * it has so far with a full scan of the inner side. It then reopens the inner side and repeats
+ * with the next part of the outer side. The inner side is scanned again rather than spilled
+ * because its slots stay visible to the stages above.
+ *
  * Debug string representation:
  *
  *   hj collatorSlot?
@@ -81,6 +88,13 @@ public:
     std::vector<DebugPrinter::Block> debugPrint() const final;
 
 private:
+    /**
+     * Clears the hash table and fills it with the next rows from the outer side, until either the
+     * table goes over its memory budget or the outer side is exhausted, in which case the outer
+     * side is closed.
+     */
+    void buildHashTable();
+
     using TableType = std::unordered_multimap<value::MaterializedRow,  // NOLINT
                                               value::MaterializedRow,
                                               value::MaterializedRowHasher,
@@ -125,6 +139,13 @@ private:
 
     vm::ByteCode _bytecode;
 
+    const long long _approxMemoryUseInBytes = internalQuerySBEHashJoinApproxMemoryUseInBytes.load();
+
+    // True while the outer side has rows left that have not been loaded into the hash table.
+    bool _outerOpened{false};
+
     bool _compiled{false};
+
+    HashJoinStats _specificStats;
 };
 }  // namespace mongo::sbe
@@ -85,6 +85,7 @@ void MakeObjStageBase<O>::prepare(CompileCtx& ctx) {
         // Mark the values from _fields with 'std::numeric_limits<size_t>::max()'.
         auto [it, inserted] = _allFieldsMap.emplace(p, std::numeric_limits<size_t>::max());
         uassert(4822818, str::stream() << "duplicate field: " << p, inserted);
+        _fieldNameLengths |= lengthBit(p.size());
     }
 
     for (size_t idx = 0; idx < _projectFields.size(); ++idx) {
@@ -92,6 +93,7 @@ void MakeObjStageBase<O>::prepare(CompileCtx& ctx) {
         // Mark the values from _projectFields with their corresponding index.
         auto [it, inserted] = _allFieldsMap.emplace(p, idx);
         uassert(4822819, str::stream() << "duplicate field: " << p, inserted);
+        _fieldNameLengths |= lengthBit(p.size());
         _projects.emplace_back(p, _children[0]->getAccessor(ctx, _projectVars[idx]));
     }
 
@@ -169,9 +171,7 @@ void MakeObjStageBase<MakeObjOutputType::object>::produceObject() {
                 be += 4;
                 while (*be != 0) {
                     auto sv = bson::fieldNameView(be);
-                    auto key = StringMapHasher{}.hashed_key(StringData(sv));
-
-                    if (!isFieldProjectedOrRestricted(key)) {
+                    if (!isFieldProjectedOrRestricted(StringData(sv))) {
                         auto [tag, val] = bson::convertFrom<true>(be, end, sv.size());
                         auto [copyTag, copyVal] = value::copyValue(tag, val);
                         obj->push_back(sv, copyTag, copyVal);
@@ -194,9 +194,7 @@ void MakeObjStageBase<MakeObjOutputType::object>::produceObject() {
                 obj->reserve(numOutputFields);
                 for (size_t idx = 0; idx < objRoot->size(); ++idx) {
                     auto sv = objRoot->field(idx);
-                    auto key = StringMapHasher{}.hashed_key(StringData(sv));
-
-                    if (!isFieldProjectedOrRestricted(key)) {
+                    if (!isFieldProjectedOrRestricted(StringData(sv))) {
                         auto [tag, val] = objRoot->getAt(idx);
                         auto [copyTag, copyVal] = value::copyValue(tag, val);
                         obj->push_back(sv, copyTag, copyVal);
@@ -252,11 +250,9 @@ void MakeObjStageBase<MakeObjOutputType::bsonObject>::produceObject() {
                 be += 4;
                 while (*be != 0) {
                     auto sv = bson::fieldNameView(be);
-                    auto key = StringMapHasher{}.hashed_key(StringData(sv));
-
                     auto nextBe = bson::advance(be, sv.size());
 
-                    if (!isFieldProjectedOrRestricted(key)) {
+                    if (!isFieldProjectedOrRestricted(StringData(sv))) {
                         bob.append(BSONElement(
                             be, sv.size() + 1, nextBe - be, BSONElement::CachedSizeTag{}));
                         --nFieldsNeededIfInclusion;
@@ -273,9 +269,7 @@ void MakeObjStageBase<MakeObjOutputType::bsonObject>::produceObject() {
             if (!(nFieldsNeededIfInclusion == 0 && _fieldBehavior == FieldBehavior::keep)) {
                 auto objRoot = value::getObjectView(val);
                 for (size_t idx = 0; idx < objRoot->size(); ++idx) {
-                    auto key = StringMapHasher{}.hashed_key(StringData(objRoot->field(idx)));
-
-                    if (!isFieldProjectedOrRestricted(key)) {
+                    if (!isFieldProjectedOrRestricted(StringData(objRoot->field(idx)))) {
                         auto [tag, val] = objRoot->getAt(idx);
                         bson::appendValueToBsonObj(bob, objRoot->field(idx), tag, val);
                         --nFieldsNeededIfInclusion;
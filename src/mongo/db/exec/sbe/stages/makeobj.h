@@ -108,12 +108,16 @@ private:
     void projectField(value::Object* obj, size_t idx);
     void projectField(UniqueBSONObjBuilder* bob, size_t idx);
 
-    bool isFieldProjectedOrRestricted(const StringMapHashedKey& key) const {
+    bool isFieldProjectedOrRestricted(StringData fieldName) const {
         bool foundKey = false;
         bool projected = false;
         bool restricted = false;
 
-        if (!_allFieldsMap.empty()) {
+        // Only hash the name if some field in '_allFieldsMap' has the same length. In wide
+        // documents most fields are neither projected nor restricted, and this lets them skip the
+        // hash computation and the map probe.
+        if (!_allFieldsMap.empty() && (_fieldNameLengths & lengthBit(fieldName.size()))) {
+            auto key = StringMapHasher{}.hashed_key(fieldName);
             if (auto it = _allFieldsMap.find(key); it != _allFieldsMap.end()) {
                 foundKey = true;
                 projected = it->second != std::numeric_limits<size_t>::max();
@@ -127,6 +131,14 @@ private:
         return projected || restricted;
     }
 
+    /**
+     * Maps a field name length to a bit in '_fieldNameLengths'. All lengths of 63 or more share
+     * the top bit.
+     */
+    static uint64_t lengthBit(size_t length) {
+        return uint64_t{1} << std::min<size_t>(length, 63);
+    }
+
     void produceObject();
 
     const value::SlotId _objSlot;
@@ -139,6 +151,8 @@ private:
     const bool _returnOldObject;
 
     StringMap<size_t> _allFieldsMap;
+    // A bitmask of the lengths of the field names in '_allFieldsMap', see lengthBit().
+    uint64_t _fieldNameLengths{0};
 
     std::vector<std::pair<std::string, value::SlotAccessor*>> _projects;
 
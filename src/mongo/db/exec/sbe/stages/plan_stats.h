@@ -196,6 +196,22 @@ struct TraverseStats : public SpecificStats {
     size_t innerCloses{0};
 };
 
+struct HashJoinStats : public SpecificStats {
+    std::unique_ptr<SpecificStats> clone() const final {
+        return std::make_unique<HashJoinStats>(*this);
+    }
+
+    uint64_t estimateObjectSizeInBytes() const final {
+        return sizeof(*this);
+    }
+
+    // The number of times the inner side was scanned. This is more than one when the outer side
+    // did not fit into the hash table at once.
+    size_t passes{0};
+    // The approximate size in bytes of the largest hash table that was built.
+    uint64_t maxTableSizeBytes{0};
+};
+
 /**
  * Calculates the total number of physical reads in the given plan stats tree. If a stage can do
  * a physical read (e.g. COLLSCAN or IXSCAN), then its 'numReads' stats is added to the total.
@@ -32,8 +32,11 @@
 #include "mongo/db/exec/sbe/stages/sort.h"
 
 #include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/values/bson.h"
 #include "mongo/db/exec/trial_run_tracker.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/util/str.h"
 
 namespace {
@@ -60,11 +63,21 @@ SortStage::SortStage(std::unique_ptr<PlanStage> input,
       _dirs(std::move(dirs)),
       _vals(std::move(vals)),
       _allowDiskUse(allowDiskUse),
+      _useKeyStringKeys(internalQuerySlotBasedExecutionSortUseKeyStringKeys.load() &&
+                        _obs.size() <= Ordering::kMaxCompoundIndexKeys),
       _mergeData({0, 0}) {
     _children.emplace_back(std::move(input));
 
     invariant(_obs.size() == _dirs.size());
 
+    if (_useKeyStringKeys) {
+        BSONObjBuilder orderingBob;
+        for (auto dir : _dirs) {
+            orderingBob.append("", dir == value::SortDirection::Descending ? -1 : 1);
+        }
+        _ordering = Ordering::make(orderingBob.done());
+    }
+
     _specificStats.limit = limit;
     _specificStats.maxMemoryUsageBytes = memoryLimit;
 }
@@ -86,18 +99,24 @@ void SortStage::prepare(CompileCtx& ctx) {
     _children[0]->prepare(ctx);
 
     size_t counter = 0;
-    // Process order by fields.
+    // Process order by fields. When sorting on KeyStrings, the original order-by values are
+    // stored at the front of each row's values.
     for (auto& slot : _obs) {
         _inKeyAccessors.emplace_back(_children[0]->getAccessor(ctx, slot));
-        auto [it, inserted] =
-            _outAccessors.emplace(slot,
-                                  std::make_unique<value::MaterializedRowKeyAccessor<SorterData*>>(
-                                      _mergeDataIt, counter));
+        std::unique_ptr<value::SlotAccessor> outAccessor;
+        if (_useKeyStringKeys) {
+            outAccessor = std::make_unique<value::MaterializedRowValueAccessor<SorterData*>>(
+                _mergeDataIt, counter);
+        } else {
+            outAccessor = std::make_unique<value::MaterializedRowKeyAccessor<SorterData*>>(
+                _mergeDataIt, counter);
+        }
+        auto [it, inserted] = _outAccessors.emplace(slot, std::move(outAccessor));
         ++counter;
         uassert(4822812, str::stream() << "duplicate field: " << slot, inserted);
     }
 
-    counter = 0;
+    counter = _useKeyStringKeys ? _obs.size() : 0;
     // Process value fields.
     for (auto& slot : _vals) {
         _inValueAccessors.emplace_back(_children[0]->getAccessor(ctx, slot));
@@ -127,6 +146,20 @@ void SortStage::makeSorter() {
         _specificStats.limit != std::numeric_limits<size_t>::max() ? _specificStats.limit : 0;
     opts.moveSortedDataIntoIterator = true;
 
+    if (_useKeyStringKeys) {
+        // Each row's key holds a single KeyString which already encodes the sort directions.
+        auto comp = [](const SorterData& lhs, const SorterData& rhs) {
+            auto [lhsTag, lhsVal] = lhs.first.getViewOfValue(0);
+            auto [rhsTag, rhsVal] = rhs.first.getViewOfValue(0);
+            return value::getKeyStringView(lhsVal)->compare(*value::getKeyStringView(rhsVal));
+        };
+
+        _sorter.reset(
+            Sorter<value::MaterializedRow, value::MaterializedRow>::make(opts, comp, {}));
+        _mergeIt.reset();
+        return;
+    }
+
     auto comp = [&](const SorterData& lhs, const SorterData& rhs) {
         auto size = lhs.first.size();
         auto& left = lhs.first;
@@ -149,6 +182,30 @@ void SortStage::makeSorter() {
     _mergeIt.reset();
 }
 
+std::pair<value::TypeTags, value::Value> SortStage::makeKeyStringSortKey() const {
+    BSONObjBuilder keyBob;
+    for (size_t idx = 0; idx < _inKeyAccessors.size(); ++idx) {
+        auto [tag, val] = _inKeyAccessors[idx]->getViewOfValue();
+        if (tag == value::TypeTags::ksValue) {
+            // The sort key was already generated as a KeyString, which happens when the sort
+            // pattern has parts with a common prefix. Such a key is the only, ascending, key.
+            tassert(5859100,
+                    "A precomputed KeyString sort key must be the only, ascending, sort key",
+                    _inKeyAccessors.size() == 1 &&
+                        _dirs[idx] == value::SortDirection::Ascending);
+            return value::copyValue(tag, val);
+        } else if (tag == value::TypeTags::Nothing) {
+            // A missing sort key sorts as null.
+            keyBob.appendNull("");
+        } else {
+            bson::appendValueToBsonObj(keyBob, "", tag, val);
+        }
+    }
+
+    KeyString::Builder kb(KeyString::Version::kLatestVersion, keyBob.done(), _ordering);
+    return value::makeCopyKeyString(kb.getValueCopy());
+}
+
 void SortStage::doDetachFromTrialRunTracker() {
     _tracker = nullptr;
 }
@@ -167,17 +224,29 @@ void SortStage::open(bool reOpen) {
     makeSorter();
 
     while (_children[0]->getNext() == PlanState::ADVANCED) {
-        value::MaterializedRow keys{_inKeyAccessors.size()};
-        value::MaterializedRow vals{_inValueAccessors.size()};
+        value::MaterializedRow keys{_useKeyStringKeys ? 1 : _inKeyAccessors.size()};
+        value::MaterializedRow vals{_useKeyStringKeys
+                                        ? _inKeyAccessors.size() + _inValueAccessors.size()
+                                        : _inValueAccessors.size()};
 
         size_t idx = 0;
+        if (_useKeyStringKeys) {
+            auto [ksTag, ksVal] = makeKeyStringSortKey();
+            keys.reset(0, true, ksTag, ksVal);
+        }
         for (auto accessor : _inKeyAccessors) {
             auto [tag, val] = accessor->getViewOfValue();
             auto [cTag, cVal] = copyValue(tag, val);
-            keys.reset(idx++, true, cTag, cVal);
+            if (_useKeyStringKeys) {
+                vals.reset(idx++, true, cTag, cVal);
+            } else {
+                keys.reset(idx++, true, cTag, cVal);
+            }
         }
 
-        idx = 0;
+        if (!_useKeyStringKeys) {
+            idx = 0;
+        }
         for (auto accessor : _inValueAccessors) {
             auto [tag, val] = accessor->getViewOfValue();
             auto [cTag, cVal] = copyValue(tag, val);
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include "mongo/bson/ordering.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 
 namespace mongo {
@@ -54,6 +55,12 @@ namespace mongo::sbe {
  * If 'limit' is not std::numeric_limits<size_t>::max(), then this is a top-k sort that should only
  * return the number of rows given by the limit.
  *
+ * When the 'internalQuerySlotBasedExecutionSortUseKeyStringKeys' knob is enabled, the order-by
+ * values of each row are encoded once into a single KeyString (honouring 'dirs'), so that both
+ * the in-memory sort and the merge of spilled runs compare rows with a memcmp rather than by
+ * interpreting each value. In that mode the original order-by values travel with the row's
+ * values so that they can still be returned unchanged.
+ *
  * This stage is a binding reflector, meaning that only the 'obs' and 'vals' slots are visible to
  * nodes higher in the tree.
  *
@@ -93,6 +100,12 @@ protected:
 private:
     void makeSorter();
 
+    /**
+     * Encodes the current values of the order-by slots as a KeyString, in the sort order given by
+     * '_ordering'. Used only when '_useKeyStringKeys' is true.
+     */
+    std::pair<value::TypeTags, value::Value> makeKeyStringSortKey() const;
+
     using SorterIterator = SortIteratorInterface<value::MaterializedRow, value::MaterializedRow>;
     using SorterData = std::pair<value::MaterializedRow, value::MaterializedRow>;
 
@@ -100,6 +113,14 @@ private:
     const std::vector<value::SortDirection> _dirs;
     const value::SlotVector _vals;
     const bool _allowDiskUse;
+
+    // Whether rows are sorted on a KeyString encoding of the order-by values instead of on the
+    // values themselves.
+    const bool _useKeyStringKeys;
+
+    // The per-key sort directions, in the form understood by KeyString.
+    Ordering _ordering{Ordering::make(BSONObj())};
+
     SortStats _specificStats;
 
     std::vector<value::SlotAccessor*> _inKeyAccessors;
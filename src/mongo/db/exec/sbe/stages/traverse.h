@@ -56,6 +56,12 @@ namespace mongo::sbe {
  * individual results into a single output value. Another expression 'finalExpr' controls optional
  * short-circuiting (a.k.a. early out) logic.
  *
+ * Input arrays are never copied: they are walked in place through a value::ArrayAccessor, including
+ * BSON arrays. With a fold only the running value is kept, so predicates over large arrays run in
+ * constant memory and stop at the first element that decides them. Only traversals without a fold
+ * build an output array, one element per element of the input. Every element costs a reopen of
+ * the inner side, so this stage is still evaluated one element at a time.
+ *
  * Debug string representation:
  *
  *  traverse outputSlot outputFromInnerBranchSlot inputSlot [<correlated slots>]
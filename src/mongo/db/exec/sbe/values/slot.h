@@ -640,6 +640,11 @@ private:
  * populated with those values will hold pointers into the buffer. The 'valueBufferBuilder' is
  * caller owned, and it can be reset and reused once it is safe to invalidate any accessors that
  * might reference it.
+ *
+ * Components are decoded straight into SBE values with no intermediate BSONObj, and decoding stops
+ * after the last component selected by 'indexKeysToInclude'. Components before that which are not
+ * selected are still decoded and then dropped. KeyString does not encode component lengths, so the
+ * reader can only move past a component by decoding it.
  */
 void readKeyStringValueIntoAccessors(
     const KeyString::Value& keyString,
@@ -1127,7 +1127,8 @@ inline std::pair<TypeTags, Value> copyValue(TypeTags tag, Value val) {
         case TypeTags::StringBig:
             return makeBigString(getStringView(tag, val));
         case TypeTags::bsonString:
-            return makeBigString(getStringView(tag, val));
+            // Short strings read from BSON are copied inline rather than on the heap.
+            return makeNewString(getStringView(tag, val));
         case TypeTags::bsonSymbol:
             return makeNewBsonSymbol(getStringOrSymbolView(tag, val));
         case TypeTags::ObjectId: {
@@ -103,6 +103,7 @@ int Instruction::stackOffset[Instruction::Tags::lastInstruction] = {
 
     -1,  // fillEmpty
     -1,  // getField
+    0,   // getFieldImm
     -1,  // getElement
     -1,  // collComparisonKey
     -1,  // getFieldOrElement
@@ -346,6 +347,21 @@ void CodeFragment::appendGetField() {
     appendSimpleInstruction(Instruction::getField);
 }
 
+void CodeFragment::appendGetFieldImm(StringData fieldName) {
+    invariant(fieldName.size() <= kMaxImmFieldNameSize);
+
+    Instruction i;
+    i.tag = Instruction::getFieldImm;
+    adjustStackSimple(i);
+
+    uint8_t size = fieldName.size();
+    auto offset = allocateSpace(sizeof(Instruction) + sizeof(size) + size);
+
+    offset += writeToMemory(offset, i);
+    offset += writeToMemory(offset, size);
+    memcpy(offset, fieldName.rawData(), size);
+}
+
 void CodeFragment::appendGetElement() {
     appendSimpleInstruction(Instruction::getElement);
 }
@@ -524,8 +540,12 @@ std::tuple<bool, value::TypeTags, value::Value> ByteCode::getField(value::TypeTa
         return {false, value::TypeTags::Nothing, 0};
     }
 
-    auto fieldStr = value::getStringView(fieldTag, fieldValue);
+    return getField(objTag, objValue, value::getStringView(fieldTag, fieldValue));
+}
 
+std::tuple<bool, value::TypeTags, value::Value> ByteCode::getField(value::TypeTags objTag,
+                                                                   value::Value objValue,
+                                                                   StringData fieldStr) {
     if (MONGO_unlikely(failOnPoisonedFieldLookup.shouldFail())) {
         uassert(4623399, "Lookup of $POISON", fieldStr != "POISON");
     }
@@ -4370,6 +4390,23 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                     }
                     break;
                 }
+                case Instruction::getFieldImm: {
+                    auto size = readFromMemory<uint8_t>(pcPointer);
+                    pcPointer += sizeof(size);
+                    StringData fieldName(reinterpret_cast<const char*>(pcPointer), size);
+                    pcPointer += size;
+
+                    auto [objOwned, objTag, objVal] = getFromStack(0);
+
+                    auto [owned, tag, val] = getField(objTag, objVal, fieldName);
+
+                    topStack(owned, tag, val);
+
+                    if (objOwned) {
+                        value::releaseValue(objTag, objVal);
+                    }
+                    break;
+                }
                 case Instruction::getElement: {
                     auto [rhsOwned, rhsTag, rhsVal] = getFromStack(0);
                     popStack();
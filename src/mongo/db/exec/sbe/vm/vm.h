@@ -255,6 +255,7 @@ struct Instruction {
 
         fillEmpty,
         getField,
+        getFieldImm,  // getField with the field name stored inline in the instruction
         getElement,
         collComparisonKey,
         getFieldOrElement,
@@ -426,6 +427,9 @@ using ArityType = uint32_t;
 
 class CodeFragment {
 public:
+    // The longest field name which can be stored inline in a 'getFieldImm' instruction.
+    static constexpr size_t kMaxImmFieldNameSize = std::numeric_limits<uint8_t>::max();
+
     auto& instrs() {
         return _instrs;
     }
@@ -505,6 +509,13 @@ public:
         appendSimpleInstruction(Instruction::fillEmpty);
     }
     void appendGetField();
+    /**
+     * Appends a 'getFieldImm' instruction, which looks up the constant 'fieldName' in the object on
+     * top of the stack. Compared to pushing the field name and emitting 'getField', this saves one
+     * instruction dispatch and one stack push/pop per evaluation. The field name must not exceed
+     * 'kMaxImmFieldNameSize' bytes.
+     */
+    void appendGetFieldImm(StringData fieldName);
     void appendGetElement();
     void appendCollComparisonKey();
     void appendGetFieldOrElement();
@@ -604,6 +615,13 @@ private:
     std::vector<value::TypeTags> _argStackTags;
     std::vector<value::Value> _argStackVals;
 
+    /**
+     * Interprets 'code' from 'position' with a switch over the instruction tag. Instructions carry
+     * their operands inline, including raw SlotAccessor pointers, so a CodeFragment is bound to the
+     * plan that compiled it. A native backend would have to compile per plan instance, and its
+     * cost would add to the bytecode compilation that every prepare() does, even on a plan cache
+     * hit.
+     */
     void runInternal(const CodeFragment* code, int64_t position);
     std::tuple<bool, value::TypeTags, value::Value> runLambdaInternal(const CodeFragment* code,
                                                                       int64_t position);
@@ -678,6 +696,9 @@ private:
                                                          value::TypeTags collTag,
                                                          value::Value collValue);
 
+    std::tuple<bool, value::TypeTags, value::Value> getField(value::TypeTags objTag,
+                                                             value::Value objValue,
+                                                             StringData fieldStr);
     std::tuple<bool, value::TypeTags, value::Value> getField(value::TypeTags objTag,
                                                              value::Value objValue,
                                                              value::TypeTags fieldTag,
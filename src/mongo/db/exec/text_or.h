@@ -47,6 +47,12 @@ class OperationContext;
  * the positive terms in the search query, as well as their scores.
  *
  * The WorkingSetMembers returned are fetched and in the LOC_AND_OBJ state.
+ *
+ * Every candidate is scored, even when a later sort on the text score is followed by a limit.
+ * Top-k pruning schemes such as WAND need each term's postings in RecordId order so they can skip
+ * ahead, but text index keys are {prefix, term, score, suffix}. A term's entries are therefore
+ * ordered by score and cannot be seeked by RecordId. A per-document upper bound is also unknown
+ * until the document has been fetched and passed '_filter'.
  */
 class TextOrStage final : public RequiresCollectionStage {
 public:
@@ -88,6 +88,11 @@ private:
  * and IS_EOF is returned if no documents were found or all updates have been performed.
  *
  * Callers of doWork() must be holding a write lock.
+ *
+ * Each matched document is written, together with its index changes and oplog entry, in its own
+ * WriteUnitOfWork. Multi-updates therefore cannot batch and sort index maintenance across
+ * documents: the stage yields between documents, and a write conflict must only roll back the
+ * document that hit it.
  */
 class UpdateStage : public RequiresMutableCollectionStage {
     UpdateStage(const UpdateStage&) = delete;
@@ -58,6 +58,11 @@ namespace mongo {
  *
  * NOTE: This compression ignores non-number data, and assumes the non-number data is constant
  * across all documents in the series of documents.
+ *
+ * NOTE: The layout of a metric chunk is read by external diagnostic tools as well as by
+ * FTDCDecompressor, so changing the encoding (for example to delta-of-delta) would need a new
+ * chunk type rather than a change to this one. Counters that advance steadily already delta to
+ * runs of equal values, which VarInt and ZLIB compress well.
  */
 class FTDCCompressor {
     FTDCCompressor(const FTDCCompressor&) = delete;
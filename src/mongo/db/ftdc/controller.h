@@ -72,6 +72,10 @@ public:
 
     /**
      * Set the period for data collection.
+     *
+     * This takes effect from the next sample, so a short high-resolution capture can be taken at
+     * runtime by lowering 'diagnosticDataCollectionPeriodMillis' (to as little as 100ms) and
+     * restoring it afterwards.
      */
     void setPeriod(Milliseconds millis);
 
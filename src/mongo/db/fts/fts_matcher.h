@@ -67,6 +67,10 @@ public:
 
     /**
      * Returns whether 'obj' contains all positive phrases.
+     *
+     * Phrases are checked against the fetched document because text index keys record only a
+     * term and its aggregate score, not where the term occurs, so adjacency cannot be decided from
+     * the index alone.
      */
     bool positivePhrasesMatch(const BSONObj& obj) const;
 
@@ -71,9 +71,6 @@ Status S2GetKeysForElement(const BSONElement& element,
     if (!status.isOK())
         return status;
 
-    S2RegionCoverer coverer;
-    params.configureCoverer(geoContainer, &coverer);
-
     // Don't index big polygon
     if (geoContainer.getNativeCRS() == STRICT_SPHERE) {
         return Status(ErrorCodes::BadValue, "can't index geometry with strict winding order");
@@ -96,6 +93,18 @@ Status S2GetKeysForElement(const BSONElement& element,
 
     invariant(geoContainer.hasS2Region());
 
+    // A point's region is the leaf cell containing it, and configureCoverer() pins the covering of
+    // points to the leaf level for these index versions, so that cell is the whole covering. Skip
+    // the coverer, which would otherwise search all the way down from the cube faces.
+    if (params.indexVersion >= S2_INDEX_VERSION_3 && geoContainer.isPoint()) {
+        const S2CellId cellId = geoContainer.getPoint().cell.id();
+        dassert(cellId.is_leaf());
+        out->push_back(cellId);
+        return Status::OK();
+    }
+
+    S2RegionCoverer coverer;
+    params.configureCoverer(geoContainer, &coverer);
     coverer.GetCovering(geoContainer.getS2Region(), out);
     return Status::OK();
 }
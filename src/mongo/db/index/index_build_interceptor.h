@@ -129,6 +129,11 @@ public:
      *
      * This is resumable, so subsequent calls will start the scan at the record immediately
      * following the last inserted record from a previous call to drainWritesIntoIndex.
+     *
+     * Side writes are applied in the order they were recorded, because an insert and a later
+     * delete of the same key must not be reordered. The IndexBuildsCoordinator drains once under
+     * an intent lock, yielding between batches, and again under a shared lock before taking the
+     * exclusive lock, so the final drain only applies writes that arrived in the meantime.
      */
     Status drainWritesIntoIndex(OperationContext* opCtx,
                                 const CollectionPtr& coll,
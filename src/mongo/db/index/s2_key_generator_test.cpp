@@ -45,6 +45,10 @@
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/str.h"
 
+#include "third_party/s2/s2cell.h"
+#include "third_party/s2/s2latlng.h"
+#include "third_party/s2/s2regioncoverer.h"
+
 using namespace mongo;
 
 namespace {
@@ -258,6 +262,22 @@ TEST_F(S2KeyGeneratorTest, GetS2KeysFromMultiPointInGeoField) {
     assertMultikeyPathsEqual(MultikeyPaths{MultikeyComponents{}, {0U}}, actualMultikeyPaths);
 }
 
+TEST_F(S2KeyGeneratorTest, PointKeyMatchesLeafLevelCovering) {
+    // Points bypass the region coverer, so check that they generate the cell that covering them at
+    // the leaf level would.
+    for (auto [x, y] : std::vector<std::pair<int, int>>{{0, 0}, {1, 1}, {-73, 40}, {179, -89}}) {
+        S2Cell cell(S2LatLng::FromDegrees(y, x).Normalized().ToPoint());
+        S2RegionCoverer coverer;
+        coverer.set_min_level(S2::kMaxCellLevel);
+        coverer.set_max_level(S2::kMaxCellLevel);
+        std::vector<S2CellId> covering;
+        coverer.GetCovering(cell, &covering);
+
+        ASSERT_EQUALS(1U, covering.size());
+        ASSERT_EQUALS(static_cast<long long>(covering[0].id()), getCellID(x, y));
+    }
+}
+
 TEST_F(S2KeyGeneratorTest, CollationAppliedToNonGeoStringFieldAfterGeoField) {
     BSONObj obj = fromjson("{a: {type: 'Point', coordinates: [0, 0]}, b: 'string'}");
     BSONObj keyPattern = fromjson("{a: '2dsphere', b: 1}");
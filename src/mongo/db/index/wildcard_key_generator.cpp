@@ -108,7 +108,11 @@ WildcardKeyGenerator::WildcardKeyGenerator(BSONObj keyPattern,
       _keyPattern(keyPattern),
       _keyStringVersion(keyStringVersion),
       _ordering(ordering),
-      _rsKeyFormat(rsKeyFormat) {}
+      _rsKeyFormat(rsKeyFormat),
+      _excludesOnlyTopLevelId(
+          pathProjection.isEmpty() &&
+          keyPattern.firstElement().fieldNameStringData().find(kSubtreeSuffix) ==
+              std::string::npos) {}
 
 void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBufferBuilder,
                                         BSONObj inputDoc,
@@ -122,7 +126,9 @@ void WildcardKeyGenerator::generateKeys(SharedBufferFragmentBuilder& pooledBuffe
     if (multikeyPaths)
         multikeyPathsSequence = multikeyPaths->extract_sequence();
     _traverseWildcard(pooledBufferBuilder,
-                      _proj.exec()->applyTransformation(Document{inputDoc}).toBson(),
+                      _excludesOnlyTopLevelId
+                          ? inputDoc
+                          : _proj.exec()->applyTransformation(Document{inputDoc}).toBson(),
                       false,
                       &rootPath,
                       &keysSequence,
@@ -145,6 +151,10 @@ void WildcardKeyGenerator::_traverseWildcard(SharedBufferFragmentBuilder& pooled
         if (elem.fieldNameStringData().find('.', 0) != std::string::npos)
             continue;
 
+        // The default projection has not been applied to 'obj', so drop the top-level _id here.
+        if (_excludesOnlyTopLevelId && path->numParts() == 0 && elem.fieldNameStringData() == "_id")
+            continue;
+
         // Append the element's fieldname to the path, if the enclosing object is not an array.
         pushPathComponent(elem, objIsArray, path);
 
@@ -120,5 +120,10 @@ private:
     const KeyString::Version _keyStringVersion;
     const Ordering _ordering;
     const KeyFormat _rsKeyFormat;
+
+    // True if the index uses the default projection, which only removes the top-level _id field.
+    // In that case keys are generated directly from the input document, skipping _id, instead of
+    // materializing the projected copy of it.
+    const bool _excludesOnlyTopLevelId;
 };
 }  // namespace mongo
@@ -114,6 +114,31 @@ TEST_F(WildcardKeyGeneratorFullDocumentTest, ExtractTopLevelKey) {
     ASSERT(assertKeysetsEqual(expectedMultikeyPaths, multikeyMetadataKeys));
 }
 
+TEST_F(WildcardKeyGeneratorFullDocumentTest, ExcludeOnlyTopLevelId) {
+    WildcardKeyGenerator keyGen{fromjson("{'$**': 1}"),
+                                {},
+                                nullptr,
+                                KeyString::Version::kLatestVersion,
+                                Ordering::make(BSONObj()),
+                                rsKeyFormat};
+    auto inputDoc = fromjson("{_id: 1, a: {_id: 2}, b: [{_id: 3}]}");
+
+    auto expectedKeys =
+        makeKeySet({fromjson("{'': 'a._id', '': 2}"), fromjson("{'': 'b._id', '': 3}")});
+
+    auto expectedMultikeyPaths = makeKeySet(
+        {fromjson("{'': 1, '': 'b'}")},
+        record_id_helpers::reservedIdFor(
+            record_id_helpers::ReservationId::kWildcardMultikeyMetadataId, rsKeyFormat));
+
+    auto outputKeys = makeKeySet();
+    auto multikeyMetadataKeys = makeKeySet();
+    keyGen.generateKeys(allocator, inputDoc, &outputKeys, &multikeyMetadataKeys);
+
+    ASSERT(assertKeysetsEqual(expectedKeys, outputKeys));
+    ASSERT(assertKeysetsEqual(expectedMultikeyPaths, multikeyMetadataKeys));
+}
+
 TEST_F(WildcardKeyGeneratorFullDocumentTest, ExtractKeysFromNestedObject) {
     WildcardKeyGenerator keyGen{fromjson("{'$**': 1}"),
                                 {},
@@ -39,6 +39,11 @@ class OperationContext;
 
 /**
  * Invoked when database profile is enabled.
+ *
+ * The entry is inserted into the capped 'system.profile' collection synchronously, on the thread
+ * of the operation being profiled, before the operation's response is sent. Callers rely on this:
+ * a client that reads 'system.profile' after an operation returns will find that operation's
+ * entry. Deferring the write to a background sink would give up that guarantee.
  */
 void profile(OperationContext* opCtx, NetworkOp op);
 
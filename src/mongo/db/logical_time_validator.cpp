@@ -95,7 +95,8 @@ SignedLogicalTime LogicalTimeValidator::_getProof(const KeysCollectionDocument&
     auto key = keyDoc.getKey();
 
     // Compare and calculate HMAC inside mutex to prevent multiple threads computing HMAC for the
-    // same cluster time.
+    // same cluster time. TimeProofService also caches the HMAC for the last range of times that
+    // differ only in the low 16 bits of the increment, so a new time rarely recomputes it.
     stdx::lock_guard<Latch> lk(_mutex);
     // Note: _lastSeenValidTime will initially not have a proof set.
     if (newTime == _lastSeenValidTime.getTime() && _lastSeenValidTime.getProof()) {
@@ -173,7 +174,7 @@ Status LogicalTimeValidator::validate(OperationContext* opCtx, const SignedLogic
         return status;
     }
 
-    auto keys = keyStatusWith.getValue();
+    const auto& keys = keyStatusWith.getValue();
     invariant(!keys.empty());
 
     const auto newProof = newTime.getProof();
@@ -397,6 +397,10 @@ public:
     //
     // Determine if a document satisfies the tree-predicate.
     //
+    // Evaluation walks the tree, and each leaf resolves its own path in the document, so predicates
+    // on different fields each look up their field separately. Conjunctions and disjunctions stop
+    // at the first child that decides the result.
+    //
 
     virtual bool matches(const MatchableDocument* doc, MatchDetails* details = nullptr) const = 0;
 
@@ -642,6 +642,12 @@ public:
 private:
     ExpressionOptimizerFunc getOptimizer() const final;
 
+    /**
+     * Recomputes '_equalitySet' and '_equalityHashSet' from '_originalEqualityVector', which must
+     * already be sorted according to '_eltCmp'.
+     */
+    void _updateEqualitySet();
+
     // Whether or not '_equalities' has a jstNULL element in it.
     bool _hasNull = false;
 
@@ -665,10 +671,13 @@ private:
     // support std::binary_search. Because we need to sort the elements anyway for things like index
     // bounds building, using binary search avoids the overhead of inserting into a hash table which
     // doesn't pay for itself in the common case where lookups are done a few times if ever.
-    // TODO It may be worth dynamically creating a hashset after matchesSingleElement() has been
-    // called "many" times.
     std::vector<BSONElement> _equalitySet;
 
+    // Holds the elements of '_equalitySet' when there are at least
+    // internalQueryInMatchHashedLookupThreshold of them, so that contains() on a large list is a
+    // hash probe rather than a binary search. Hashing respects '_eltCmp', including its collator.
+    boost::optional<BSONElementComparator::UnorderedSet> _equalityHashSet;
+
     // Container of regex elements this object owns.
     std::vector<std::unique_ptr<RegexMatchExpression>> _regexes;
 
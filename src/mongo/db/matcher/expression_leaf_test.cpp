@@ -37,6 +37,7 @@
 #include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/unittest/death_test.h"
 
 namespace mongo {
@@ -1439,6 +1440,105 @@ TEST(InMatchExpression, ChangingCollationAfterAddingEqualitiesPreservesEqualitie
     ASSERT(in.contains(obj2.firstElement()));
 }
 
+/**
+ * Returns enough distinct equalities for an InMatchExpression to answer contains() with a hash set
+ * lookup rather than a binary search. Each value is produced by 'makeValue' from its index.
+ */
+template <typename MakeValue>
+BSONArray makeHashedLookupOperand(MakeValue makeValue) {
+    BSONArrayBuilder bab;
+    const int count = 2 * internalQueryInMatchHashedLookupThreshold.load();
+    for (int i = 0; i < count; ++i) {
+        makeValue(&bab, i);
+    }
+    return bab.arr();
+}
+
+std::vector<BSONElement> toEqualities(const BSONArray& operand) {
+    std::vector<BSONElement> equalities;
+    for (auto&& elt : operand) {
+        equalities.push_back(elt);
+    }
+    return equalities;
+}
+
+TEST(InMatchExpression, HashedLookupMatchesNumericallyEquivalentValues) {
+    BSONArray operand =
+        makeHashedLookupOperand([](BSONArrayBuilder* bab, int i) { bab->append(i); });
+    InMatchExpression in("");
+    ASSERT_OK(in.setEqualities(toEqualities(operand)));
+
+    BSONObj matches = BSON_ARRAY(7 << 7.0 << 7LL << Decimal128(7));
+    for (auto&& elt : matches) {
+        ASSERT(in.contains(elt));
+        ASSERT(in.matchesSingleElement(elt));
+    }
+
+    BSONObj notMatches = BSON_ARRAY(7.5 << -1 << static_cast<long long>(operand.nFields()) << "7");
+    for (auto&& elt : notMatches) {
+        ASSERT(!in.contains(elt));
+        ASSERT(!in.matchesSingleElement(elt));
+    }
+}
+
+TEST(InMatchExpression, HashedLookupRespectsCollation) {
+    BSONArray operand = makeHashedLookupOperand(
+        [](BSONArrayBuilder* bab, int i) { bab->append(str::stream() << "string" << i); });
+    BSONObj upperCase = BSON(""
+                             << "STRING7");
+
+    InMatchExpression noCollation("");
+    ASSERT_OK(noCollation.setEqualities(toEqualities(operand)));
+    ASSERT(!noCollation.contains(upperCase.firstElement()));
+
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+    InMatchExpression in("");
+    in.setCollator(&collator);
+    ASSERT_OK(in.setEqualities(toEqualities(operand)));
+    ASSERT(in.contains(upperCase.firstElement()));
+    ASSERT(!in.contains(BSON(""
+                             << "STRING")
+                            .firstElement()));
+}
+
+TEST(InMatchExpression, HashedLookupIsRebuiltBySetCollator) {
+    BSONArray operand = makeHashedLookupOperand(
+        [](BSONArrayBuilder* bab, int i) { bab->append(str::stream() << "string" << i); });
+    BSONObj upperCase = BSON(""
+                             << "STRING7");
+
+    InMatchExpression in("");
+    ASSERT_OK(in.setEqualities(toEqualities(operand)));
+    ASSERT(!in.contains(upperCase.firstElement()));
+
+    CollatorInterfaceMock toLower(CollatorInterfaceMock::MockType::kToLowerString);
+    in.setCollator(&toLower);
+    ASSERT(in.contains(upperCase.firstElement()));
+
+    CollatorInterfaceMock reverse(CollatorInterfaceMock::MockType::kReverseString);
+    in.setCollator(&reverse);
+    ASSERT(!in.contains(upperCase.firstElement()));
+    ASSERT(in.contains(BSON(""
+                            << "string7")
+                           .firstElement()));
+}
+
+TEST(InMatchExpression, HashedLookupSurvivesShallowClone) {
+    BSONArray operand =
+        makeHashedLookupOperand([](BSONArrayBuilder* bab, int i) { bab->append(i); });
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kToLowerString);
+    auto in = std::make_unique<InMatchExpression>("");
+    in->setCollator(&collator);
+    ASSERT_OK(in->setEqualities(toEqualities(operand)));
+
+    auto clone = in->shallowClone();
+    in.reset();
+
+    auto clonedIn = static_cast<InMatchExpression*>(clone.get());
+    ASSERT(clonedIn->contains(BSON("" << 7.0).firstElement()));
+    ASSERT(!clonedIn->contains(BSON("" << 7.5).firstElement()));
+}
+
 std::vector<uint32_t> bsonArrayToBitPositions(const BSONArray& ba) {
     std::vector<uint32_t> bitPositions;
 
@@ -90,6 +90,10 @@ public:
 
     /**
      * Return all eligible hosts from a HelloResponse that we should mirror to.
+     *
+     * Eligible hosts are the 'hosts' of the response other than the primary itself, which are the
+     * electable members; passives, hidden members and arbiters are never mirrored to. The choice
+     * among them is uniform, since the primary has no view of each secondary's cache.
      */
     std::vector<HostAndPort> getRawMirroringTargets(
         const std::shared_ptr<const repl::HelloResponse>& isMaster) noexcept;
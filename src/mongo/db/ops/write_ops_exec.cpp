@@ -663,7 +663,7 @@ WriteResult performInserts(OperationContext* opCtx,
             batch.emplace_back(source == OperationSource::kTimeseriesInsert && wholeOp.getStmtIds()
                                    ? *wholeOp.getStmtIds()
                                    : std::vector<StmtId>{stmtId},
-                               toInsert);
+                               std::move(toInsert));
 
             bytesInBatch += batch.back().doc.objsize();
 
@@ -69,6 +69,9 @@ struct WriteResult {
  * NotPrimaryErrorTracker in that case. This should generally be combined with
  * NotPrimaryErrorTracker handling from parse failures.
  *
+ * Inserts amortize per-statement costs by grouping documents into WriteUnitOfWorks of up to
+ * 'internalInsertMaxBatchSize' documents.
+ *
  * 'type' indicates whether the operation was induced by a standard write, a chunk migration, or a
  * time-series insert.
  *
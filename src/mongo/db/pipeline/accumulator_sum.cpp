@@ -72,9 +72,13 @@ void AccumulatorSum::processInternal(const Value& input, bool merging) {
         return;
     }
 
-    // Upgrade to the widest type required to hold the result.
-    totalType = Value::getWidestNumeric(totalType, input.getType());
-    switch (input.getType()) {
+    // Upgrade to the widest type required to hold the result. Inputs are usually all of one type,
+    // in which case the total already has that type and no widening is needed.
+    const auto inputType = input.getType();
+    if (inputType != totalType) {
+        totalType = Value::getWidestNumeric(totalType, inputType);
+    }
+    switch (inputType) {
         case NumberLong:
             nonDecimalTotal.addLong(input.getLong());
             break;
@@ -377,6 +377,36 @@ std::unique_ptr<MatchExpression> matchRewriteFullDocument(
     return rewrittenPredicate;
 }
 
+/**
+ * Rewrites filters on 'updateDescription' in a format that can be applied directly to the oplog.
+ * Returns nullptr if the predicate cannot be rewritten.
+ */
+std::unique_ptr<MatchExpression> matchRewriteUpdateDescription(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx,
+    const PathMatchExpression* predicate,
+    bool allowInexact) {
+    tassert(5859501, "Unexpected empty predicate path", predicate->fieldRef()->numParts() > 0);
+    tassert(5859502,
+            str::stream() << "Unexpected predicate path: " << predicate->path(),
+            predicate->fieldRef()->getPart(0) ==
+                DocumentSourceChangeStream::kUpdateDescriptionField);
+
+    // The contents of 'updateDescription' are derived from either a '$v: 1' modifier-style or a
+    // '$v: 2' delta-style oplog entry, so translating the predicate itself is impractical. However,
+    // only non-replacement update events have an 'updateDescription'. Unless the predicate can
+    // match a missing field, we can therefore rewrite it inexactly as:
+    //   {$and: [{op: 'u'}, {'o._id': {$exists: false}}]}
+    if (!allowInexact || predicate->matchesBSON(BSONObj())) {
+        return nullptr;
+    }
+
+    auto updateCase = std::make_unique<AndMatchExpression>();
+    updateCase->add(std::make_unique<EqualityMatchExpression>("op"_sd, Value("u"_sd)));
+    updateCase->add(
+        std::make_unique<NotMatchExpression>(std::make_unique<ExistsMatchExpression>("o._id"_sd)));
+    return updateCase;
+}
+
 // Helper to rewrite predicates on any change stream namespace field of the form {db: "dbName",
 // coll: "collName"} into the oplog.
 
@@ -747,7 +777,8 @@ StringMap<MatchExpressionRewrite> matchRewriteRegistry = {
     {"documentKey", matchRewriteDocumentKey},
     {"fullDocument", matchRewriteFullDocument},
     {"ns", matchRewriteNs},
-    {"to", matchRewriteTo}};
+    {"to", matchRewriteTo},
+    {"updateDescription", matchRewriteUpdateDescription}};
 
 // Map of field names to corresponding agg Expression rewrite functions.
 StringMap<AggExpressionRewrite> exprRewriteRegistry = {{"operationType", exprRewriteOperationType}};
@@ -309,6 +309,10 @@ public:
      * to getNext(). Such stages must retrieve a result from their child and then release it (or
      * return it) before asking for another result. Failing to do so can result in extra work, since
      * the Document/Value library must copy data on write when that data has a refcount above one.
+     *
+     * Results are pulled one at a time through every stage. Leading $match, $sort and projection
+     * stages avoid this per-document overhead by being absorbed into the query executor (see
+     * PipelineD::buildInnerQueryExecutor()).
      */
     GetNextResult getNext() {
         pExpCtx->checkForInterrupt();
@@ -37,6 +37,10 @@ namespace mongo {
 /**
  * Part of the change stream API machinery used to look up the post-image of a document. Uses the
  * "documentKey" field of the input to look up the new version of the document.
+ *
+ * Each update event is looked up on its own, with an 'afterClusterTime' read concern at that
+ * event's time, as soon as the event is pulled. Batching lookups across events would mean
+ * buffering events ahead of the consumer, which would delay delivery on a tailing stream.
  */
 class DocumentSourceChangeStreamAddPostImage final
     : public DocumentSource,
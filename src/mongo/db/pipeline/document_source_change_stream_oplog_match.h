@@ -35,6 +35,11 @@ namespace mongo {
 /**
  * A custom subclass of DocumentSourceMatch which is used to generate a $match stage to be applied
  * on the oplog. The stage requires itself to be the first stage in the pipeline.
+ *
+ * Being first lets the filter be pushed down into the oplog collection scan, so entries for other
+ * namespaces are rejected on raw BSON, without being converted to Documents. Each change stream
+ * still has its own oplog cursor: a scan shared between streams would have to reconcile their
+ * resume points, read concerns and the lifetimes of their cursors.
  */
 class DocumentSourceChangeStreamOplogMatch final : public DocumentSourceMatch,
                                                    public ChangeStreamStageSerializationInterface {
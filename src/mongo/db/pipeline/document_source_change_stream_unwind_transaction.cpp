@@ -206,10 +206,10 @@ DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::TransactionO
                                                       << input[repl::OpTime::kTermFieldName]));
     _clusterTime = txnOpTime.getTimestamp();
 
-    auto commandObj = input["o"].getDocument();
-    Value applyOps = commandObj["applyOps"];
+    auto commandObj = input["o"].getDocument().toBson();
+    auto applyOps = commandObj["applyOps"];
 
-    if (!applyOps.missing()) {
+    if (!applyOps.eoo()) {
         // We found an applyOps that implicitly commits a transaction. We include it in the
         // '_txnOplogEntries' stack of applyOps entries that the change stream should process as
         // part of this transaction. There may be additional applyOps entries linked through the
@@ -225,7 +225,7 @@ DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::TransactionO
         // it in the '_txnOplogEntries' stack.
         tassert(5543803,
                 str::stream() << "Unexpected op at " << input["ts"].getTimestamp().toString(),
-                !commandObj["commitTransaction"].missing());
+                !commandObj["commitTransaction"].eoo());
     }
 
     if (BSONType::Object ==
@@ -250,7 +250,8 @@ DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::TransactionO
                 str::stream() << "Expected no transaction entries, found "
                               << _txnOplogEntries.size(),
                 _txnOplogEntries.size() == 0);
-        _currentApplyOps = std::move(applyOps);
+        DocumentSourceChangeStream::checkValueType(Value(applyOps), "applyOps", BSONType::Array);
+        _currentApplyOps = applyOps.Obj().getOwned();
     } else {
         // This transaction consists of multiple oplog entries; grab the chronologically first
         // entry and extract its "applyOps" array.
@@ -261,13 +262,11 @@ DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::TransactionO
                 str::stream() << "Expected 'applyOps' type " << BSONType::Array << ", found "
                               << bsonOp["applyOps"].type(),
                 BSONType::Array == bsonOp["applyOps"].type());
-        _currentApplyOps = Value(bsonOp["applyOps"]);
+        _currentApplyOps = bsonOp["applyOps"].Obj().getOwned();
     }
 
-    DocumentSourceChangeStream::checkValueType(_currentApplyOps, "applyOps", BSONType::Array);
-
     // Initialize iterators at the beginning of the transaction.
-    _currentApplyOpsIt = _currentApplyOps.getArray().begin();
+    _currentApplyOpsIt = BSONObjIterator(_currentApplyOps);
     _txnOpIndex = 0;
 }
 
@@ -275,13 +274,15 @@ boost::optional<Document>
 DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::getNextTransactionOp(
     OperationContext* opCtx) {
     while (true) {
-        while (_currentApplyOpsIt != _currentApplyOps.getArray().end()) {
-            Document doc = (_currentApplyOpsIt++)->getDocument();
+        while (_currentApplyOpsIt.more()) {
+            BSONObj op = _currentApplyOpsIt.next().Obj();
             ++_txnOpIndex;
 
-            // If the document is relevant, update it with the required txn fields before returning.
-            if (_isDocumentRelevant(doc)) {
-                return _addRequiredTransactionFields(doc);
+            // The filter is evaluated against the raw BSON of the operation, so only relevant
+            // operations are copied out of the applyOps array and materialized as Documents. If the
+            // operation is relevant, update it with the required txn fields before returning.
+            if (_isDocumentRelevant(op)) {
+                return _addRequiredTransactionFields(Document(op.getOwned()));
             }
         }
 
@@ -301,23 +302,22 @@ DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::getNextTrans
                               << bsonOp["applyOps"].type(),
                 BSONType::Array == bsonOp["applyOps"].type());
 
-        _currentApplyOps = Value(bsonOp["applyOps"]);
-        _currentApplyOpsIt = _currentApplyOps.getArray().begin();
+        _currentApplyOps = bsonOp["applyOps"].Obj().getOwned();
+        _currentApplyOpsIt = BSONObjIterator(_currentApplyOps);
     }
 }
 
 bool DocumentSourceChangeStreamUnwindTransaction::TransactionOpIterator::_isDocumentRelevant(
-    const Document& d) const {
+    const BSONObj& op) const {
+    auto opType = op["op"];
     tassert(5543808,
             str::stream() << "Unexpected format for entry within a transaction oplog entry: "
                              "'op' field was type "
-                          << typeName(d["op"].getType()),
-            d["op"].getType() == BSONType::String);
-    tassert(5543809,
-            "Unexpected noop entry within a transaction",
-            ValueComparator::kInstance.evaluate(d["op"] != Value("n"_sd)));
+                          << typeName(opType.type()),
+            opType.type() == BSONType::String);
+    tassert(5543809, "Unexpected noop entry within a transaction", opType.valueStringData() != "n");
 
-    return _expression->matchesBSON(d.toBson());
+    return _expression->matchesBSON(op);
 }
 
 Document
@@ -107,7 +107,9 @@ private:
      * Note that our view of a transaction in the oplog is like an array of arrays with an "outer"
      * array of applyOps entries represented by the 'txnOplogEntries' field and "inner" arrays of
      * applyOps entries. Each applyOps entry gets loaded on demand, with only a single applyOps
-     * loaded into '_applyOpsValue' and '_currentApplyOps' at any time.
+     * array held in '_currentApplyOps' at any time. Operations are filtered against their raw BSON
+     * as the array is iterated, and only those that pass the filter are materialized as Documents,
+     * so memory use is bounded by the size of one applyOps entry however large the transaction.
      *
      * Likewise, there are "outer" and "inner" iterators, 'txnOplogEntriesIt' and
      * '_currentApplyOpsIt' respectively, that together reference the current transaction operation.
@@ -158,7 +160,7 @@ private:
 
         // Helper for getNextTransactionOp(). Checks the namespace of the given document to see if
         // it should be returned in the change stream.
-        bool _isDocumentRelevant(const Document& d) const;
+        bool _isDocumentRelevant(const BSONObj& op) const;
 
         // Traverse backwards through the oplog by starting at the entry at 'firstOpTime' and
         // following "prevOpTime" links until reaching the terminal "prevOpTime" value, and push the
@@ -181,15 +183,14 @@ private:
         // ordered chronologically, in the same order as entries appear in the oplog.
         std::stack<repl::OpTime> _txnOplogEntries;
 
-        // The '_currentapplyOps' stores the applyOps array that the TransactionOpIterator is
-        // currently iterating.
-        Value _currentApplyOps;
+        // The '_currentapplyOps' stores an owned copy of the applyOps array that the
+        // TransactionOpIterator is currently iterating.
+        BSONObj _currentApplyOps;
 
         // This iterator references the next operation within the '_currentApplyOps' array that the
         // the getNextTransactionOp() method will return. When there are no more operations to
-        // iterate, this iterator will point to the array's "end" sentinel, and '_txnOplogEntries'
-        // will be empty.
-        typename std::vector<Value>::const_iterator _currentApplyOpsIt;
+        // iterate, this iterator will be exhausted, and '_txnOplogEntries' will be empty.
+        BSONObjIterator _currentApplyOpsIt{_currentApplyOps};
 
         // Our current place within the entire transaction, which may consist of multiple 'applyOps'
         // arrays.
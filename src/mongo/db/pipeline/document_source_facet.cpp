@@ -160,6 +160,7 @@ DocumentSource::GetNextResult DocumentSourceFacet::doGetNext() {
                 usedBytes <= maxBytes);
     };
 
+    // The facets are drained in turn, since they all pull from the same TeeBuffer.
     vector<vector<Value>> results(_facets.size());
     bool allPipelinesEOF = false;
     while (!allPipelinesEOF) {
@@ -44,6 +44,7 @@
 #include "mongo/db/matcher/expression_geo.h"
 #include "mongo/db/matcher/expression_internal_bucket_geo_within.h"
 #include "mongo/db/matcher/expression_internal_expr_comparison.h"
+#include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/pipeline/document_source_add_fields.h"
 #include "mongo/db/pipeline/document_source_geo_near.h"
 #include "mongo/db/pipeline/document_source_group.h"
@@ -54,6 +55,7 @@
 #include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/util/make_data_structure.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
 #include "mongo/logv2/log.h"
@@ -241,6 +243,7 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceInternalUnpackBucket::createF
     auto hasBucketMaxSpanSeconds = false;
     auto bucketMaxSpanSeconds = 0;
     std::vector<std::string> computedMetaProjFields;
+    BSONObj eventFilter;
     for (auto&& elem : specElem.embeddedObject()) {
         auto fieldName = elem.fieldNameStringData();
         if (fieldName == kInclude || fieldName == kExclude) {
@@ -311,6 +314,11 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceInternalUnpackBucket::createF
                         field.find('.') == std::string::npos);
                 bucketSpec.computedMetaProjFields.emplace_back(field);
             }
+        } else if (fieldName == kEventFilter) {
+            uassert(5346511,
+                    str::stream() << "eventFilter field must be an object, got: " << elem.type(),
+                    elem.type() == BSONType::Object);
+            eventFilter = elem.Obj();
         } else {
             uasserted(5346506,
                       str::stream()
@@ -325,8 +333,12 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceInternalUnpackBucket::createF
             "The $_internalUnpackBucket stage requires a bucketMaxSpanSeconds parameter",
             hasBucketMaxSpanSeconds);
 
-    return make_intrusive<DocumentSourceInternalUnpackBucket>(
+    auto unpackStage = make_intrusive<DocumentSourceInternalUnpackBucket>(
         expCtx, BucketUnpacker{std::move(bucketSpec), unpackerBehavior}, bucketMaxSpanSeconds);
+    if (!eventFilter.isEmpty()) {
+        unpackStage->setEventFilter(eventFilter);
+    }
+    return unpackStage;
 }
 
 boost::intrusive_ptr<DocumentSource> DocumentSourceInternalUnpackBucket::createFromBsonExternal(
@@ -405,6 +417,10 @@ void DocumentSourceInternalUnpackBucket::serializeToArray(
                          return compFields;
                      }()});
 
+    if (_eventFilter) {
+        out.addField(kEventFilter, Value{_eventFilterBson});
+    }
+
     if (!explain) {
         array.push_back(Value(DOC(getSourceName() << out.freeze())));
         if (_sampleSize) {
@@ -423,6 +439,10 @@ void DocumentSourceInternalUnpackBucket::serializeToArray(
 DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
     tassert(5521502, "calling doGetNext() when '_sampleSize' is set is disallowed", !_sampleSize);
 
+    if (_eventFilter) {
+        return getNextMatchingEventFilter();
+    }
+
     // Otherwise, fallback to unpacking every measurement in all buckets until the child stage is
     // exhausted.
     if (_bucketUnpacker.hasNext()) {
@@ -444,6 +464,53 @@ DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
     return nextResult;
 }
 
+DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::getNextMatchingEventFilter() {
+    while (true) {
+        while (_bucketUnpacker.hasNext()) {
+            if (auto measurement = _bucketUnpacker.getNextMatching()) {
+                return std::move(*measurement);
+            }
+        }
+
+        auto nextResult = pSource->getNext();
+        if (!nextResult.isAdvanced()) {
+            return nextResult;
+        }
+
+        auto bucket = nextResult.getDocument().toBson();
+        _bucketUnpacker.reset(std::move(bucket));
+        uassert(5346512,
+                str::stream() << "A bucket with _id "
+                              << _bucketUnpacker.bucket()[timeseries::kBucketIdFieldName].toString()
+                              << " contains an empty data region",
+                _bucketUnpacker.hasNext());
+    }
+}
+
+void DocumentSourceInternalUnpackBucket::setEventFilter(BSONObj eventFilter) {
+    uassert(5346513,
+            "The $_internalUnpackBucket stage does not support $text in its eventFilter",
+            !DocumentSourceMatch::isTextQuery(eventFilter));
+
+    _eventFilterBson = eventFilter.getOwned();
+    _eventFilter = uassertStatusOK(MatchExpressionParser::parse(
+        _eventFilterBson, pExpCtx, ExtensionsCallbackNoop(), Pipeline::kAllowedMatcherFeatures));
+
+    DepsTracker deps;
+    _eventFilter->addDependencies(&deps);
+    uassert(5346514,
+            "The $_internalUnpackBucket stage requires its eventFilter to depend on a finite set "
+            "of fields",
+            !deps.needWholeDocument);
+
+    // The unpacker reads whole columns, so it only needs to know the top-level fields.
+    std::set<std::string> filterFields;
+    for (auto&& path : deps.fields) {
+        filterFields.emplace(FieldPath::extractFirstFieldFromDottedPath(path));
+    }
+    _bucketUnpacker.setEventFilter(_eventFilter.get(), std::move(filterFields));
+}
+
 bool DocumentSourceInternalUnpackBucket::pushDownComputedMetaProjection(
     Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
     bool nextStageWasRemoved = false;
@@ -727,6 +794,22 @@ DocumentSourceInternalUnpackBucket::createPredicatesOnBucketLevelField(
         if (andMatchExpr->numChildren() > 0) {
             return andMatchExpr;
         }
+    } else if (matchExpr->matchType() == MatchExpression::OR) {
+        auto nextOr = static_cast<const OrMatchExpression*>(matchExpr);
+        auto orMatchExpr = std::make_unique<OrMatchExpression>();
+
+        // Unlike $and, dropping a child of an $or would wrongly exclude the buckets that only it
+        // could match, so the $or is mapped only if each of its children is.
+        for (size_t i = 0; i < nextOr->numChildren(); i++) {
+            auto child = createPredicatesOnBucketLevelField(nextOr->getChild(i));
+            if (!child) {
+                return nullptr;
+            }
+            orMatchExpr->add(std::move(child));
+        }
+        if (orMatchExpr->numChildren() > 0) {
+            return orMatchExpr;
+        }
     } else if (ComparisonMatchExpression::isComparisonMatchExpression(matchExpr)) {
         return createComparisonPredicate(static_cast<const ComparisonMatchExpression*>(matchExpr),
                                          _bucketUnpacker.bucketSpec(),
@@ -835,6 +918,11 @@ DocumentSourceInternalUnpackBucket::rewriteGroupByMinMax(Pipeline::SourceContain
             AccumulationExpression accExpr = stmt.expr;
             accExpr.argument = newExpr;
             accumulationStatements.emplace_back(stmt.fieldName, std::move(accExpr));
+        } else {
+            // The control fields only hold the min and max of individual fields, so an aggregate
+            // over any other expression cannot be answered from them.
+            suitable = false;
+            break;
         }
     }
 
@@ -915,7 +1003,9 @@ Pipeline::SourceContainer::iterator DocumentSourceInternalUnpackBucket::doOptimi
             return container->end();
         }
     }
-    {
+    // Neither of the next two rewrites accounts for an absorbed event filter: the first reads the
+    // buckets without unpacking them, and the second would stop unpacking the filter's fields.
+    if (!_eventFilter) {
         // Check if we can avoid unpacking if we have a group stage with min/max aggregates.
         auto [success, result] = rewriteGroupByMinMax(itr, container);
         if (success) {
@@ -923,7 +1013,7 @@ Pipeline::SourceContainer::iterator DocumentSourceInternalUnpackBucket::doOptimi
         }
     }
 
-    {
+    if (!_eventFilter) {
         // Check if the rest of the pipeline needs any fields. For example we might only be
         // interested in $count.
         auto deps = Pipeline::getDependenciesForContainer(
@@ -1047,6 +1137,37 @@ Pipeline::SourceContainer::iterator DocumentSourceInternalUnpackBucket::doOptimi
         }
     }
 
+    // Once every other rewrite had a chance to use it, absorb a $match on the measurements so that
+    // it is evaluated on the bucket's columns rather than on materialized measurements. The
+    // unpacker evaluates the filter on columns this stage may not output, so a filter that depends
+    // on any field this stage removes, on computed meta projections, or on the whole document, is
+    // left in place.
+    if (auto nextMatch = dynamic_cast<DocumentSourceMatch*>(std::next(itr)->get()); nextMatch &&
+        internalQueryUnpackBucketPushDownEventFilter.load() && !_sampleSize && !_eventFilter &&
+        _bucketUnpacker.bucketSpec().computedMetaProjFields.empty() && !nextMatch->isTextQuery()) {
+        DepsTracker deps;
+        nextMatch->getMatchExpression()->addDependencies(&deps);
+        const auto& spec = _bucketUnpacker.bucketSpec();
+        auto isOutputField = [&](const std::string& path) {
+            auto field = FieldPath::extractFirstFieldFromDottedPath(path);
+            if (spec.metaField && field == *spec.metaField) {
+                return _bucketUnpacker.includeMetaField();
+            }
+            if (field == spec.timeField) {
+                return _bucketUnpacker.includeTimeField();
+            }
+            return determineIncludeField(field, _bucketUnpacker.behavior(), spec);
+        };
+        if (!deps.needWholeDocument &&
+            std::all_of(deps.fields.begin(), deps.fields.end(), isOutputField)) {
+            setEventFilter(nextMatch->getQuery());
+            container->erase(std::next(itr));
+
+            // Give the stages which now follow this one a chance to optimize with it.
+            return itr;
+        }
+    }
+
     return container->end();
 }
 }  // namespace mongo
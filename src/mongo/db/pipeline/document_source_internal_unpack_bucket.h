@@ -44,6 +44,7 @@ public:
     static constexpr StringData kInclude = "include"_sd;
     static constexpr StringData kExclude = "exclude"_sd;
     static constexpr StringData kBucketMaxSpanSeconds = "bucketMaxSpanSeconds"_sd;
+    static constexpr StringData kEventFilter = "eventFilter"_sd;
 
     static boost::intrusive_ptr<DocumentSource> createFromBsonInternal(
         BSONElement elem, const boost::intrusive_ptr<ExpressionContext>& expCtx);
@@ -155,6 +156,10 @@ public:
      *      {control.min.time: {$_internalExprLt: new Date(...)}}
      * ]}
      *
+     * An $and maps to the conjunction of whichever of its children could be mapped, whereas an $or
+     * is only mapped when every one of its children can be, since a bucket must be kept if any
+     * branch might match one of its measurements.
+     *
      * If the provided predicate is ineligible for this mapping, the function will return a nullptr.
      */
     std::unique_ptr<MatchExpression> createPredicatesOnBucketLevelField(
@@ -175,6 +180,18 @@ public:
         return _sampleSize;
     }
 
+    /**
+     * Sets a filter on the unpacked measurements, evaluated while unpacking, before measurements
+     * are materialized. The filter sees the bucket's columns whether or not this stage outputs
+     * them, so it is only equivalent to a $match on 'eventFilter' immediately following this stage
+     * when every field it depends on is one this stage outputs.
+     */
+    void setEventFilter(BSONObj eventFilter);
+
+    const MatchExpression* eventFilter() const {
+        return _eventFilter.get();
+    }
+
     /**
      * If the stage after $_internalUnpackBucket is $project, $addFields, or $set, try to extract
      * from it computed meta projections and push them pass the current stage. Return true if the
@@ -202,6 +219,12 @@ public:
 private:
     GetNextResult doGetNext() final;
 
+    /**
+     * Returns the next measurement which satisfies '_eventFilter', unpacking buckets from the
+     * child stage as needed.
+     */
+    GetNextResult getNextMatchingEventFilter();
+
     BucketUnpacker _bucketUnpacker;
     int _bucketMaxSpanSeconds;
 
@@ -213,5 +236,10 @@ private:
     bool _triedBucketLevelFieldsPredicatesPushdown = false;
     bool _optimizedEndOfPipeline = false;
     bool _triedInternalizeProject = false;
+
+    // An optional filter on the unpacked measurements, which the unpacker evaluates before it
+    // materializes them. '_eventFilterBson' owns the BSON that '_eventFilter' was parsed from.
+    BSONObj _eventFilterBson;
+    std::unique_ptr<MatchExpression> _eventFilter;
 };
 }  // namespace mongo
@@ -31,6 +31,7 @@
 
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
 #include "mongo/db/query/util/make_data_structure.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace mongo {
 namespace {
@@ -94,6 +95,30 @@ TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadata) {
     ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
 }
 
+TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadataAfterAbsorbedMatchNegative) {
+    RAIIServerParameterControllerForTest controller("internalQueryUnpackBucketPushDownEventFilter",
+                                                    true);
+    auto unpackSpecObj = fromjson(
+        "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], metaField: 'meta1', timeField: 't', "
+        "bucketMaxSpanSeconds: 3600}}");
+    auto matchSpecObj = fromjson("{$match: {a: {$gt: 1}}}");
+    auto groupSpecObj =
+        fromjson("{$group: {_id: '$meta1.a.b', accmin: {$min: '$b'}, accmax: {$max: '$c'}}}");
+
+    auto pipeline =
+        Pipeline::parse(makeVector(unpackSpecObj, matchSpecObj, groupSpecObj), getExpCtx());
+    pipeline->optimizePipeline();
+
+    // The $match is absorbed into $_internalUnpackBucket, so the buckets' control min and max no
+    // longer describe the measurements reaching $group, and the $group is not rewritten.
+    auto serialized = pipeline->serializeToBson();
+    ASSERT_GTE(serialized.size(), 2u);
+    auto unpack = serialized[serialized.size() - 2];
+    ASSERT_BSONOBJ_EQ(fromjson("{a: {$gt: 1}}"),
+                      unpack["$_internalUnpackBucket"]["eventFilter"].Obj());
+    ASSERT_BSONOBJ_EQ(groupSpecObj, serialized.back());
+}
+
 TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadataNegative) {
     auto unpackSpecObj = fromjson(
         "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], timeField: 't', metaField: 'meta', "
@@ -126,5 +151,22 @@ TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadataNegative1) {
     ASSERT_BSONOBJ_EQ(groupSpecObj, serialized[1]);
 }
 
+TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadataNegativeNonPathArgument) {
+    auto unpackSpecObj = fromjson(
+        "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], timeField: 't', metaField: 'meta', "
+        "bucketMaxSpanSeconds: 3600}}");
+    auto groupSpecObj = fromjson(
+        "{$group: {_id: '$meta', accmin: {$min: '$b'}, accmax: {$max: {$ifNull: ['$b', '$c']}}}}");
+
+    auto pipeline = Pipeline::parse(makeVector(unpackSpecObj, groupSpecObj), getExpCtx());
+    pipeline->optimizePipeline();
+
+    auto serialized = pipeline->serializeToBson();
+    ASSERT_EQ(2, serialized.size());
+
+    ASSERT_BSONOBJ_EQ(unpackSpecObj, serialized[0]);
+    ASSERT_BSONOBJ_EQ(groupSpecObj, serialized[1]);
+}
+
 }  // namespace
 }  // namespace mongo
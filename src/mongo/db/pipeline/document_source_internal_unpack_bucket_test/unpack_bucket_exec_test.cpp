@@ -31,7 +31,10 @@
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
 #include "mongo/db/pipeline/document_source_internal_unpack_bucket.h"
 #include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/db/pipeline/pipeline.h"
+#include "mongo/db/query/util/make_data_structure.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace mongo {
 namespace {
@@ -905,5 +908,87 @@ TEST_F(InternalUnpackBucketExecTest, ParserRoundtripsComputedMetaProjFieldOverri
     unpackBucket->serializeToArray(array);
     ASSERT_BSONOBJ_EQ(array[0].getDocument().toBson(), bson);
 }
+
+TEST_F(InternalUnpackBucketExecTest, ParserRoundtripsEventFilter) {
+    auto bson = fromjson(
+        "{$_internalUnpackBucket: {exclude: [], timeField: 'time', metaField: 'meta', "
+        "bucketMaxSpanSeconds: 3600, eventFilter: {a: {$gt: 1}}}}");
+    auto array = std::vector<Value>{};
+    DocumentSourceInternalUnpackBucket::createFromBsonInternal(bson.firstElement(), getExpCtx())
+        ->serializeToArray(array);
+    ASSERT_BSONOBJ_EQ(array[0].getDocument().toBson(), bson);
+}
+
+TEST_F(InternalUnpackBucketExecTest, ParserRejectsNonObjectEventFilter) {
+    ASSERT_THROWS_CODE(DocumentSourceInternalUnpackBucket::createFromBsonInternal(
+                           fromjson("{$_internalUnpackBucket: {exclude: [], timeField: 'time', "
+                                    "bucketMaxSpanSeconds: 3600, eventFilter: 1}}")
+                               .firstElement(),
+                           getExpCtx()),
+                       AssertionException,
+                       5346511);
+}
+
+TEST_F(InternalUnpackBucketExecTest, ParserRejectsTextEventFilter) {
+    ASSERT_THROWS_CODE(DocumentSourceInternalUnpackBucket::createFromBsonInternal(
+                           fromjson("{$_internalUnpackBucket: {exclude: [], timeField: 'time', "
+                                    "bucketMaxSpanSeconds: 3600, eventFilter: {$text: {$search: "
+                                    "'abc'}}}}")
+                               .firstElement(),
+                           getExpCtx()),
+                       AssertionException,
+                       5346513);
+}
+
+TEST_F(InternalUnpackBucketExecTest, MatchOnExcludedFieldIsNotAbsorbedAsEventFilter) {
+    RAIIServerParameterControllerForTest controller("internalQueryUnpackBucketPushDownEventFilter",
+                                                    true);
+    auto expCtx = getExpCtx();
+    auto pipeline = Pipeline::parse(
+        makeVector(fromjson("{$_internalUnpackBucket: {include: ['_id', 'a'], timeField: 'time', "
+                            "metaField: 'myMeta', bucketMaxSpanSeconds: 3600}}"),
+                   fromjson("{$match: {b: {$gte: 1}}}")),
+        expCtx);
+    pipeline->optimizePipeline();
+
+    // The second bucket has a measurement with 'b' equal to 1, but 'b' is not included in the
+    // unpacked measurements, so the $match following the stage matches nothing.
+    auto source = DocumentSourceMock::createForTest(
+        {"{control: {'version': 1, min: {_id: 1, time: 1, a: 1, b: 0}, max: {_id: 2, time: 2, a: "
+         "2, b: 0}}, meta: {'m1': 999}, data: {_id: {'0':1, '1':2}, time: {'0':1, '1':2}, "
+         "a:{'0':1, '1':2}, b:{'0':0}}}",
+         "{control: {'version': 1, min: {_id: 3, time: 3, a: 1, b: 1}, max: {_id: 4, time: 4, a: "
+         "2, b: 1}}, meta: {'m1': 9}, data: {_id: {'0':3, '1':4}, time: {'0':3, '1':4}, "
+         "a:{'0':1, '1':2}, b:{'1':1}}}"},
+        expCtx);
+    pipeline->addInitialSource(source);
+
+    ASSERT_FALSE(pipeline->getNext());
+}
+
+TEST_F(InternalUnpackBucketExecTest, EventFilterOnTimeAndMetaFields) {
+    auto expCtx = getExpCtx();
+    auto spec = fromjson(
+        "{$_internalUnpackBucket: {exclude: [], timeField: 'time', metaField: 'myMeta', "
+        "bucketMaxSpanSeconds: 3600, eventFilter: {time: {$gt: 1}, 'myMeta.m1': 999}}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBsonInternal(spec.firstElement(), expCtx);
+
+    auto source = DocumentSourceMock::createForTest(
+        {"{control: {'version': 1}, meta: {'m1': 999}, data: {_id: {'0':1, '1':2}, "
+         "time: {'0':1, '1':2}, a:{'0':1, '1':2}}}",
+         "{control: {'version': 1}, meta: {'m1': 9}, data: {_id: {'0':3, '1':4}, "
+         "time: {'0':3, '1':4}, a:{'0':1, '1':2}}}"},
+        expCtx);
+    unpack->setSource(source.get());
+
+    auto next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(),
+                       Document(fromjson("{time: 2, myMeta: {m1: 999}, _id: 2, a: 2}")));
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isEOF());
+}
 }  // namespace
 }  // namespace mongo
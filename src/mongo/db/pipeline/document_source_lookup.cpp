@@ -435,6 +435,9 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
+    // The foreign side is queried once per input document. Distributing the results of one query
+    // over a batch of input documents would have to re-evaluate the $eq / $in semantics of the
+    // generated $match (arrays, null and missing, regexes, collation) outside the query system.
     if (hasLocalFieldForeignFieldJoin()) {
         auto matchStage =
             makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
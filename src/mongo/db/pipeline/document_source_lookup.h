@@ -347,7 +347,10 @@ private:
     // For use when $lookup is specified with localField/foreignField syntax.
     boost::optional<FieldPath> _localField;
     boost::optional<FieldPath> _foreignField;
-    // Indicates the index in '_resolvedPipeline' where the local/foreignField $match resides.
+    // Indicates the index in '_resolvedPipeline' where the local/foreignField $match resides. A
+    // localField/foreignField join rewrites this $match for every input document and runs it as a
+    // separate query, so the cost per input document is one index probe on the foreign field when
+    // one exists; there is no build-once hash join strategy.
     boost::optional<size_t> _fieldMatchPipelineIdx;
 
     // Holds 'let' defined variables defined both in this stage and in parent pipelines. These are
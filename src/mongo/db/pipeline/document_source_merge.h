@@ -39,6 +39,10 @@ namespace mongo {
  * A class for the $merge aggregation stage to handle all supported merge modes. Each instance of
  * this class must be initialized (via a constructor) with a 'MergeDescriptor', which defines a
  * a particular merge strategy for a pair of 'whenMatched' and 'whenNotMatched' merge  modes.
+ *
+ * A pipeline form of 'whenMatched' can fold new partial aggregates into an existing summary
+ * document, so a rollup can be maintained incrementally by running the pipeline over only the
+ * newly arrived source documents rather than the whole collection.
  */
 class DocumentSourceMerge final : public DocumentSourceWriter<MongoProcessInterface::BatchObject> {
 public:
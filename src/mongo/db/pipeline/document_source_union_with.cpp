@@ -200,7 +200,9 @@ DocumentSource::GetNextResult DocumentSourceUnionWith::doGetNext() {
         }
         _executionState = ExecutionProgress::kStartingSubPipeline;
         // All documents from the base collection have been returned, switch to iterating the sub-
-        // pipeline by falling through below.
+        // pipeline by falling through below. The sub-pipeline is deliberately not started any
+        // earlier: it may depend on variables such as $$SEARCH_META that are only set once the
+        // outer side has run, and it shares this operation's OperationContext with it.
     }
 
     if (_executionState == ExecutionProgress::kStartingSubPipeline) {
@@ -44,6 +44,14 @@ class OperationContext;
  * This class provides a more sensible interface with JavaScript Scope objects. It helps with
  * boilerplate related to calling JS functions from C++ code, and extracting BSON objects from the
  * JS engine.
+ *
+ * Each operation builds a fresh scope, so a JavaScript-heavy workload pays for scope setup once
+ * per operation. Within an operation, function compilation is already cached by source text in
+ * Scope::createFunction(). Reusing scopes across operations through
+ * ScriptEngine::getPooledScope(), as JsFunction does, would also need: a pool key that includes
+ * the authenticated users; a reset of the 'scopeVars' globals and of the injected 'emit' native,
+ * whose data pointer belongs to one operation; and per-scope 'jsHeapLimitMB' support in the
+ * ScopeCache, which only knows the global limit.
  */
 class JsExecution {
 public:
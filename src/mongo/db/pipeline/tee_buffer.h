@@ -45,6 +45,9 @@ namespace mongo {
  * do so, it will batch incoming documents and allow each consumer to consume one batch at a time.
  * As a consequence, consumers must be able to pause their execution to allow other consumers to
  * process the batch before moving to the next batch.
+ *
+ * All consumers are driven by the single operation that owns the buffer (see $facet); a TeeBuffer
+ * cannot be shared between operations.
  */
 class TeeBuffer : public RefCountable {
 public:
@@ -156,6 +156,9 @@ void SpillableCache::spillToDisk() {
     writeBatchToDisk(records);
 }
 
+// Spilled documents are keyed by their index, so reading one is a point lookup of a known RecordId
+// rather than a scan. Keeping the spill inside the storage engine also keeps it covered by the
+// engine's encryption at rest and its temporary-table cleanup.
 Document SpillableCache::readDocumentFromDiskById(int desired) {
     tassert(5643006,
             str::stream() << "Attempted to read id " << desired
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <deque>
+
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/window_function/window_function.h"
 
@@ -67,33 +69,78 @@ protected:
     ValueMultiset _values;
 };
 
+/**
+ * Keeps the window's values in a monotonic deque: each value is dropped as soon as a later value
+ * that would be returned instead of it has been added, because it can never again be the result.
+ * The front of the deque is therefore always the current min (or max), and add() and remove()
+ * take amortized constant time rather than the logarithmic time of an ordered multiset.
+ */
 template <AccumulatorMinMax::Sense sense>
-class WindowFunctionMinMax : public WindowFunctionMinMaxCommon<sense> {
+class WindowFunctionMinMax : public WindowFunctionState {
 public:
-    using WindowFunctionMinMaxCommon<sense>::_values;
-    using WindowFunctionMinMaxCommon<sense>::_memUsageBytes;
-
     static inline const Value kDefault = Value{BSONNULL};
 
     static std::unique_ptr<WindowFunctionState> create(ExpressionContext* const expCtx) {
         return std::make_unique<WindowFunctionMinMax<sense>>(expCtx);
     }
 
-    explicit WindowFunctionMinMax(ExpressionContext* const expCtx)
-        : WindowFunctionMinMaxCommon<sense>(expCtx) {
+    explicit WindowFunctionMinMax(ExpressionContext* const expCtx) : WindowFunctionState(expCtx) {
+        _memUsageBytes = sizeof(*this);
+    }
+
+    void add(Value value) final {
+        const auto& comparator = _expCtx->getValueComparator();
+        while (!_values.empty() && isDisplacedBy(comparator, _values.back().first, value)) {
+            _memUsageBytes -= _values.back().first.getApproximateSize();
+            _values.pop_back();
+        }
+        _memUsageBytes += value.getApproximateSize();
+        _values.emplace_back(std::move(value), _numAdded++);
+    }
+
+    void remove(Value value) final {
+        // Since remove() is called in FIFO order, the value removed is always the oldest one added.
+        // It is still in the deque, at the front, only if no later value has displaced it.
+        tassert(
+            5371400, "Can't remove from an empty WindowFunctionMinMax", _numRemoved < _numAdded);
+        if (!_values.empty() && _values.front().second == _numRemoved) {
+            _memUsageBytes -= _values.front().first.getApproximateSize();
+            _values.pop_front();
+        }
+        ++_numRemoved;
+    }
+
+    void reset() final {
+        _values.clear();
+        _numAdded = 0;
+        _numRemoved = 0;
         _memUsageBytes = sizeof(*this);
     }
 
     Value getValue() const final {
         if (_values.empty())
             return kDefault;
+        return _values.front().first;
+    }
+
+private:
+    // Among values that compare equal, $min returns the oldest and $max the newest, as an ordered
+    // multiset's first and last elements would. So an equal value is kept for $min and displaced
+    // for $max.
+    static bool isDisplacedBy(const ValueComparator& comparator,
+                              const Value& existing,
+                              const Value& added) {
         if constexpr (sense == AccumulatorMinMax::Sense::kMin) {
-            return *_values.begin();
+            return comparator.compare(existing, added) > 0;
         } else {
-            return *_values.rbegin();
+            return comparator.compare(existing, added) <= 0;
         }
-        MONGO_UNREACHABLE_TASSERT(5371401);
     }
+
+    // Pairs of a value and its position in the order of add() calls.
+    std::deque<std::pair<Value, uint64_t>> _values;
+    uint64_t _numAdded = 0;
+    uint64_t _numRemoved = 0;
 };
 
 template <AccumulatorMinMax::Sense sense>
@@ -110,6 +110,33 @@ TEST_F(WindowFunctionMinMaxTest, Duplicates) {
     ASSERT_VALUE_EQ(min.getValue(), Value{77});
 }
 
+TEST_F(WindowFunctionMinMaxTest, SlidingWindowMatchesFullRecomputation) {
+    const std::vector<int> inputs{5, 1, 4, 4, 9, 2, 8, 3, 3, 7, 0, 6};
+    const size_t windowSize = 3;
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        min.add(Value{inputs[i]});
+        max.add(Value{inputs[i]});
+        if (i >= windowSize) {
+            min.remove(Value{inputs[i - windowSize]});
+            max.remove(Value{inputs[i - windowSize]});
+        }
+
+        auto windowBegin = inputs.begin() + (i >= windowSize ? i - windowSize + 1 : 0);
+        auto windowEnd = inputs.begin() + i + 1;
+        ASSERT_VALUE_EQ(min.getValue(), Value{*std::min_element(windowBegin, windowEnd)});
+        ASSERT_VALUE_EQ(max.getValue(), Value{*std::max_element(windowBegin, windowEnd)});
+    }
+
+    // Draining the window leaves it empty.
+    for (size_t i = inputs.size() - windowSize; i < inputs.size(); ++i) {
+        min.remove(Value{inputs[i]});
+        max.remove(Value{inputs[i]});
+    }
+    ASSERT_VALUE_EQ(min.getValue(), Value{BSONNULL});
+    ASSERT_VALUE_EQ(max.getValue(), Value{BSONNULL});
+}
+
 TEST_F(WindowFunctionMinMaxTest, Ties) {
     // When two elements tie (compare equal), remove() can't pick an arbitrary one,
     // because that would break the invariant that 'add(x); add(y); remove(x)' is equivalent to
@@ -133,6 +160,26 @@ TEST_F(WindowFunctionMinMaxTest, Ties) {
     ASSERT_VALUE_EQ(max.getValue(), y);
 }
 
+TEST_F(WindowFunctionMinMaxTest, TiesReturnOldestMinAndNewestMax) {
+    auto x = Value{"foo"_sd};
+    auto y = Value{"FOO"_sd};
+    ASSERT_VALUE_NE(x, y);
+    ASSERT(expCtx->getValueComparator().evaluate(x == y));
+
+    // Among equal values, $min returns the oldest one and $max the newest one.
+    min.add(x);
+    min.add(y);
+    ASSERT_VALUE_EQ(min.getValue(), x);
+    min.remove(x);
+    ASSERT_VALUE_EQ(min.getValue(), y);
+
+    max.add(x);
+    max.add(y);
+    ASSERT_VALUE_EQ(max.getValue(), y);
+    max.remove(x);
+    ASSERT_VALUE_EQ(max.getValue(), y);
+}
+
 TEST_F(WindowFunctionMinMaxTest, TracksMemoryUsageOnAddAndRemove) {
     size_t trackingSize = sizeof(WindowFunctionMin);
     ASSERT_EQ(min.getApproximateSize(), trackingSize);
@@ -106,7 +106,8 @@ private:
     bool _keysComputed;
     UpdateIndexData _indexedPaths;
 
-    // A cache for query plans. Shared across cloned Collection instances.
+    // A cache for query plans. Shared across cloned Collection instances. It lives only in memory
+    // on this node, and is rebuilt from multi-planning after a restart or when a node steps up.
     std::shared_ptr<PlanCache> _planCache;
 };
 
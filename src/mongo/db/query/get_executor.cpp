@@ -544,6 +544,11 @@ public:
         const IndexDescriptor* idIndexDesc = _collection->getIndexCatalog()->findIdIndex(_opCtx);
 
         // If we have an _id index we can use an idhack plan.
+        //
+        // Note that the IDHACK builders only consult 'plannerParams.options', yet the index entries
+        // above are still filled out first. Hoisting this check would mean defaulting the collation
+        // before fillOutPlannerParams(), which changes the query shape used to look up index
+        // filters and whether the shard key can be extracted from the query.
         if (idIndexDesc && isIdHackEligibleQuery(_collection, *_cq)) {
             LOGV2_DEBUG(
                 20922, 2, "Using idhack", "canonicalQuery"_attr = redact(_cq->toStringShort()));
@@ -29,11 +29,12 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
 #include <list>
 #include <memory>
 
 #include "mongo/base/status.h"
-#include "mongo/stdx/unordered_map.h"
+#include "mongo/stdx/trusted_hasher.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
@@ -48,8 +49,11 @@ namespace mongo {
  * for protecting concurrent access to the LRU store if used in a threaded
  * context.
  *
- * Implemented as a doubly-linked list with a hash map for quickly locating the kv-store entries.
- * The add(), get(), and remove() operations are all O(1).
+ * Implemented as a doubly-linked list indexed by an open-addressing hash table. The list owns the
+ * only per-entry allocation; the table stores the keys and list positions inline. A lookup is a
+ * probe of the table followed by an in-place splice of the found list node to the front, so
+ * promoting an entry never allocates or frees memory. The add(), get(), and remove() operations
+ * are all O(1).
  *
  * The keys of generic type K map to values of type V*. The V*
  * pointers are owned by the kv-store.
@@ -60,7 +64,12 @@ namespace mongo {
 template <class K, class V, class KeyHasher = std::hash<K>>
 class LRUKeyValue {
 public:
-    LRUKeyValue(size_t maxSize) : _maxSize(maxSize), _currentSize(0){};
+    LRUKeyValue(size_t maxSize) : _maxSize(maxSize){};
+
+    // The kv-store owns its values, so it may be moved but never copied.
+    LRUKeyValue(const LRUKeyValue&) = delete;
+    LRUKeyValue& operator=(const LRUKeyValue&) = delete;
+    LRUKeyValue(LRUKeyValue&&) = default;
 
     ~LRUKeyValue() {
         clear();
@@ -68,11 +77,15 @@ public:
 
     typedef std::pair<K, V*> KVListEntry;
 
+    // Associative container typedefs, so that the kv-store can be used with Partitioned.
+    typedef K key_type;
+    typedef KVListEntry value_type;
+
     typedef std::list<KVListEntry> KVList;
     typedef typename KVList::iterator KVListIt;
     typedef typename KVList::const_iterator KVListConstIt;
 
-    typedef stdx::unordered_map<K, KVListIt, KeyHasher> KVMap;
+    typedef absl::flat_hash_map<K, KVListIt, EnsureTrustedHasher<KeyHasher, K>> KVMap;
     typedef typename KVMap::const_iterator KVMapConstIt;
 
     /**
@@ -91,30 +104,28 @@ public:
      * an unique_ptr for the caller to use before disposing.
      */
     std::unique_ptr<V> add(const K& key, V* entry) {
-        // If the key already exists, delete it first.
-        KVMapConstIt i = _kvMap.find(key);
+        // If the key already exists, replace its value in place and promote it.
+        auto i = _kvMap.find(key);
         if (i != _kvMap.end()) {
             KVListIt found = i->second;
             delete found->second;
-            _kvMap.erase(i);
-            _kvList.erase(found);
-            _currentSize--;
+            found->second = entry;
+            _kvList.splice(_kvList.begin(), _kvList, found);
+            return std::unique_ptr<V>();
         }
 
-        _kvList.push_front(std::make_pair(key, entry));
-        _kvMap[key] = _kvList.begin();
-        _currentSize++;
+        _kvList.emplace_front(key, entry);
+        _kvMap.emplace(key, _kvList.begin());
 
         // If the store has grown beyond its allowed size,
         // evict the least recently used entry.
-        if (_currentSize > _maxSize) {
+        if (_kvList.size() > _maxSize) {
             V* evictedEntry = _kvList.back().second;
             invariant(evictedEntry);
 
             _kvMap.erase(_kvList.back().first);
             _kvList.pop_back();
-            _currentSize--;
-            invariant(_currentSize == _maxSize);
+            invariant(_kvList.size() == _maxSize);
 
             // Pass ownership of evicted entry to caller.
             // If caller chooses to ignore this unique_ptr,
@@ -141,16 +152,13 @@ public:
             return Status(ErrorCodes::NoSuchKey, "no such key in LRU key-value store");
         }
         KVListIt found = i->second;
-        V* foundEntry = found->second;
 
         // Promote the kv-store entry to the front of the list.
-        // It is now the most recently used.
-        _kvMap.erase(i);
-        _kvList.erase(found);
-        _kvList.push_front(std::make_pair(key, foundEntry));
-        _kvMap[key] = _kvList.begin();
+        // It is now the most recently used. Splicing relinks the existing node, so the map entry
+        // pointing at it stays valid.
+        _kvList.splice(_kvList.begin(), _kvList, found);
 
-        *entryOut = foundEntry;
+        *entryOut = found->second;
         return Status::OK();
     }
 
@@ -158,7 +166,7 @@ public:
      * Remove the kv-store entry keyed by 'key'.
      */
     Status remove(const K& key) {
-        KVMapConstIt i = _kvMap.find(key);
+        auto i = _kvMap.find(key);
         if (i == _kvMap.end()) {
             return Status(ErrorCodes::NoSuchKey, "no such key in LRU key-value store");
         }
@@ -166,7 +174,6 @@ public:
         delete found->second;
         _kvMap.erase(i);
         _kvList.erase(found);
-        _currentSize--;
         return Status::OK();
     }
 
@@ -179,7 +186,6 @@ public:
         }
         _kvList.clear();
         _kvMap.clear();
-        _currentSize = 0;
     }
 
     /**
@@ -193,7 +199,7 @@ public:
      * Returns the number of entries currently in the kv-store.
      */
     size_t size() const {
-        return _currentSize;
+        return _kvList.size();
     }
 
     /**
@@ -213,16 +219,14 @@ private:
     // The maximum allowable number of entries in the kv-store.
     const size_t _maxSize;
 
-    // The number of entries currently in the kv-store.
-    size_t _currentSize;
-
     // (K, V*) pairs are stored in this std::list. They are sorted in order
     // of use, where the front is the most recently used and the back is the
     // least recently used.
     mutable KVList _kvList;
 
-    // Maps from a key to the corresponding std::list entry.
-    mutable KVMap _kvMap;
+    // Maps from a key to the corresponding std::list entry. Promotion never changes which node a
+    // key maps to, so lookups do not need to modify the map.
+    KVMap _kvMap;
 };
 
 }  // namespace mongo
@@ -29,9 +29,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/optional/optional.hpp>
 #include <set>
 
+#include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/canonical_query_encoder.h"
 #include "mongo/db/query/lru_key_value.h"
@@ -467,7 +469,15 @@ public:
      */
     PlanCacheBase() : PlanCacheBase(internalQueryCacheMaxEntriesPerCollection.load()) {}
 
-    PlanCacheBase(size_t size) : _cache(size) {}
+    /**
+     * Constructs a cache holding roughly 'size' entries. Large caches are split into hash
+     * partitions, each with its own lock and LRU list, so that concurrent lookups of different
+     * query shapes do not serialize on a single latch. Small caches use a single partition and
+     * therefore keep an exact LRU eviction order.
+     */
+    PlanCacheBase(size_t size)
+        : _numPartitions(numPartitionsForSize(size)),
+          _partitionedCache((size + _numPartitions - 1) / _numPartitions) {}
 
     ~PlanCacheBase() = default;
 
@@ -526,7 +536,7 @@ public:
                                      }},
             why->stats);
         const auto key = computeKey(query);
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+        auto partition = lockPartitionFor(key);
         bool isNewEntryActive = false;
         uint32_t queryHash;
         uint32_t planCacheKey;
@@ -537,7 +547,7 @@ public:
             queryHash = key.queryHash();
         } else {
             PlanCacheEntryBase<CachedPlanType>* oldEntry = nullptr;
-            Status cacheStatus = _cache.get(key, &oldEntry);
+            Status cacheStatus = partition->get(key, &oldEntry);
             invariant(cacheStatus.isOK() || cacheStatus == ErrorCodes::NoSuchKey);
             if (oldEntry) {
                 queryHash = oldEntry->queryHash;
@@ -571,7 +581,7 @@ public:
                                                                  isNewEntryActive,
                                                                  newWorks));
 
-        auto evictedEntry = _cache.add(key, newEntry.release());
+        auto evictedEntry = partition->add(key, newEntry.release());
 
         if (nullptr != evictedEntry.get()) {
             log_detail::logCacheEviction(query.nss(), evictedEntry->debugString());
@@ -592,9 +602,9 @@ public:
         }
 
         KeyType key = computeKey(query);
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+        auto partition = lockPartitionFor(key);
         PlanCacheEntryBase<CachedPlanType>* entry = nullptr;
-        Status cacheStatus = _cache.get(key, &entry);
+        Status cacheStatus = partition->get(key, &entry);
         if (!cacheStatus.isOK()) {
             invariant(cacheStatus == ErrorCodes::NoSuchKey);
             return;
@@ -623,9 +633,9 @@ public:
      * for the query (if there is one).
      */
     GetResult get(const KeyType& key) const {
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+        auto partition = lockPartitionFor(key);
         PlanCacheEntryBase<CachedPlanType>* entry = nullptr;
-        Status cacheStatus = _cache.get(key, &entry);
+        Status cacheStatus = partition->get(key, &entry);
         if (!cacheStatus.isOK()) {
             invariant(cacheStatus == ErrorCodes::NoSuchKey);
             return {CacheEntryState::kNotPresent, nullptr};
@@ -657,16 +667,16 @@ public:
      * was present and removed and an error status otherwise.
      */
     Status remove(const CanonicalQuery& cq) {
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-        return _cache.remove(computeKey(cq));
+        const auto key = computeKey(cq);
+        auto partition = lockPartitionFor(key);
+        return partition->remove(key);
     }
 
     /**
      * Remove *all* cached plans.  Does not clear index information.
      */
     void clear() {
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-        _cache.clear();
+        _partitionedCache.clear();
     }
 
     /**
@@ -698,9 +708,9 @@ public:
         const CanonicalQuery& cq) const {
         KeyType key = computeKey(cq);
 
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
+        auto partition = lockPartitionFor(key);
         PlanCacheEntryBase<CachedPlanType>* entry;
-        Status cacheStatus = _cache.get(key, &entry);
+        Status cacheStatus = partition->get(key, &entry);
         if (!cacheStatus.isOK()) {
             return cacheStatus;
         }
@@ -714,12 +724,15 @@ public:
      * Used by planCacheListQueryShapes and index_filter_commands_test.cpp.
      */
     std::vector<std::unique_ptr<PlanCacheEntryBase<CachedPlanType>>> getAllEntries() const {
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
         std::vector<std::unique_ptr<PlanCacheEntryBase<CachedPlanType>>> entries;
+        auto all = _partitionedCache.lockAllPartitions();
 
-        for (auto&& cacheEntry : _cache) {
-            auto entry = cacheEntry.second;
-            entries.push_back(std::unique_ptr<PlanCacheEntryBase<CachedPlanType>>(entry->clone()));
+        for (auto&& partition : all) {
+            for (auto&& cacheEntry : partition) {
+                auto entry = cacheEntry.second;
+                entries.push_back(
+                    std::unique_ptr<PlanCacheEntryBase<CachedPlanType>>(entry->clone()));
+            }
         }
 
         return entries;
@@ -730,8 +743,31 @@ public:
      * Used for testing.
      */
     size_t size() const {
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-        return _cache.size();
+        return _partitionedCache.size();
+    }
+
+    /**
+     * Returns the number of entries held by each partition of the cache, indexed by partition.
+     * Only the first 'numPartitions()' partitions are ever populated.
+     */
+    std::vector<size_t> partitionSizes() const {
+        std::vector<size_t> sizes;
+        sizes.reserve(_numPartitions);
+        auto all = _partitionedCache.lockAllPartitions();
+        for (auto&& partition : all) {
+            if (sizes.size() == _numPartitions) {
+                break;
+            }
+            sizes.push_back(partition.size());
+        }
+        return sizes;
+    }
+
+    /**
+     * Returns the number of hash partitions this cache distributes its entries across.
+     */
+    size_t numPartitions() const {
+        return _numPartitions;
     }
 
     /**
@@ -752,13 +788,15 @@ public:
         const std::function<BSONObj(const PlanCacheEntryBase<CachedPlanType>&)>& serializationFunc,
         const std::function<bool(const BSONObj&)>& filterFunc) const {
         std::vector<BSONObj> results;
-        stdx::lock_guard<Latch> cacheLock(_cacheMutex);
-
-        for (auto&& cacheEntry : _cache) {
-            const auto entry = cacheEntry.second;
-            auto serializedEntry = serializationFunc(*entry);
-            if (filterFunc(serializedEntry)) {
-                results.push_back(serializedEntry);
+        auto all = _partitionedCache.lockAllPartitions();
+
+        for (auto&& partition : all) {
+            for (auto&& cacheEntry : partition) {
+                const auto entry = cacheEntry.second;
+                auto serializedEntry = serializationFunc(*entry);
+                if (filterFunc(serializedEntry)) {
+                    results.push_back(serializedEntry);
+                }
             }
         }
 
@@ -766,6 +804,15 @@ public:
     }
 
 private:
+    using Partition = LRUKeyValue<KeyType, PlanCacheEntryBase<CachedPlanType>, KeyHasher>;
+
+    // The most partitions a cache will be split into.
+    static constexpr size_t kMaxPartitions = 16;
+
+    // Caches are only split once every partition can hold at least this many entries, so that
+    // per-partition LRU eviction remains a close approximation of a global LRU policy.
+    static constexpr size_t kMinEntriesPerPartition = 64;
+
     struct NewEntryState {
         bool shouldBeCreated = false;
         bool shouldBeActive = false;
@@ -851,10 +898,27 @@ private:
         return res;
     }
 
-    LRUKeyValue<KeyType, PlanCacheEntryBase<CachedPlanType>, KeyHasher> _cache;
+    static size_t numPartitionsForSize(size_t size) {
+        return std::max(size_t{1}, std::min(kMaxPartitions, size / kMinEntriesPerPartition));
+    }
+
+    /**
+     * Locks and returns the partition responsible for 'key'. The partition is chosen from the
+     * key's hash, so all operations on a given query shape are serialized against each other but
+     * not against operations on shapes living in other partitions.
+     */
+    typename Partitioned<Partition, kMaxPartitions>::OnePartition lockPartitionFor(
+        const KeyType& key) const {
+        return _partitionedCache.lockOnePartitionById(KeyHasher{}(key) % _numPartitions);
+    }
+
+    // The number of partitions of '_partitionedCache' which are in use. Always between 1 and
+    // 'kMaxPartitions'.
+    const size_t _numPartitions;
 
-    // Protects _cache.
-    mutable Mutex _cacheMutex = MONGO_MAKE_LATCH("PlanCache::_cacheMutex");
+    // The cached entries, spread across '_numPartitions' hash partitions each protected by its
+    // own mutex. Mutable since looking up an entry promotes it in its partition's LRU list.
+    mutable Partitioned<Partition, kMaxPartitions> _partitionedCache;
 
     // Holds computed information about the collection's indexes.  Used for generating plan
     // cache keys.
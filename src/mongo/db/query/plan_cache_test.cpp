@@ -37,6 +37,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 
 #include "mongo/db/index/wildcard_key_generator.h"
@@ -604,6 +605,54 @@ TEST(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     ASSERT_EQ(planCache.get(*cqC).state, PlanCache::CacheEntryState::kPresentInactive);
 }
 
+TEST(PlanCacheTest, SmallPlanCacheUsesSinglePartition) {
+    PlanCache planCache(2);
+    ASSERT_EQ(planCache.numPartitions(), 1U);
+    ASSERT_EQ(planCache.partitionSizes().size(), 1U);
+}
+
+TEST(PlanCacheTest, LargePlanCacheSpreadsEntriesAcrossPartitions) {
+    const size_t kCacheSize = 5000;
+    PlanCache planCache(kCacheSize);
+    QueryTestServiceContext serviceContext;
+    ASSERT_GT(planCache.numPartitions(), 1U);
+
+    // Add entries for a number of distinct query shapes.
+    const size_t kNumShapes = 64;
+    std::vector<unique_ptr<CanonicalQuery>> queries;
+    for (size_t i = 0; i < kNumShapes; ++i) {
+        queries.push_back(canonicalize(BSON(std::string(str::stream() << "field" << i) << 1)));
+        addCacheEntryForShape(*queries.back(), &planCache);
+    }
+
+    // Every entry can still be looked up, and the per-partition sizes add up to the total.
+    for (auto&& cq : queries) {
+        ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kPresentInactive);
+    }
+    ASSERT_EQ(planCache.size(), kNumShapes);
+    ASSERT_EQ(planCache.getAllEntries().size(), kNumShapes);
+
+    auto partitionSizes = planCache.partitionSizes();
+    ASSERT_EQ(partitionSizes.size(), planCache.numPartitions());
+    ASSERT_EQ(std::accumulate(partitionSizes.begin(), partitionSizes.end(), size_t{0}),
+              kNumShapes);
+    ASSERT_GT(std::count_if(partitionSizes.begin(),
+                            partitionSizes.end(),
+                            [](size_t partitionSize) { return partitionSize > 0; }),
+              1);
+
+    // Removing an entry only affects its own shape, and clear() empties every partition.
+    ASSERT_OK(planCache.remove(*queries[0]));
+    ASSERT_EQ(planCache.get(*queries[0]).state, PlanCache::CacheEntryState::kNotPresent);
+    ASSERT_EQ(planCache.size(), kNumShapes - 1);
+
+    planCache.clear();
+    ASSERT_EQ(planCache.size(), 0U);
+    for (auto&& cq : queries) {
+        ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kNotPresent);
+    }
+}
+
 TEST(PlanCacheTest, PlanCacheRemoveDeletesInactiveEntries) {
     PlanCache planCache;
     unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
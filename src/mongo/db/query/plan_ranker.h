@@ -74,6 +74,10 @@ void logFailedPlan(std::function<std::string()> planSummary);
  * All specific plan scorers should inherit from this scorer and provide methods to produce the plan
  * productivity factor, and the number of plan "advances", representing the number of documents
  * returned by the PlanStage tree.
+ *
+ * Scores come only from the stats of a trial run; there are no persisted data statistics to rank
+ * candidates before they run. How often a cached winner is replanned is governed separately by
+ * internalQueryCacheEvictionRatio.
  */
 template <typename PlanStageStatsType>
 class PlanScorer {
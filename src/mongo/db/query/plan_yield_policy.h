@@ -192,6 +192,11 @@ public:
      * Periodically returns true to indicate that it is time to check for interrupt (in the case of
      * YIELD_AUTO and INTERRUPT_ONLY) or release locks or storage engine state (in the case of
      * auto-yielding plans).
+     *
+     * The schedule is deliberately independent of whether other operations are waiting. Besides
+     * letting queued lock requests through, a yield abandons the storage engine snapshot, so
+     * deferring it on an apparently idle node lets a long scan pin old versions in the WiredTiger
+     * cache.
      */
     virtual bool shouldYieldOrInterrupt(OperationContext* opCtx);
 
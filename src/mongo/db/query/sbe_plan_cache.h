@@ -79,6 +79,9 @@ public:
 /**
  * Represents the data cached in the SBE plan cache. This data holds an execution plan and necessary
  * auxiliary data for preparing and executing the PlanStage tree.
+ *
+ * The tree has its constants baked in, so it can only be reused by a query whose filter is
+ * identical to the PlanCacheKey; binding new constants would need parameter slots in the tree.
  */
 struct CachedSbePlan {
     CachedSbePlan(std::unique_ptr<sbe::PlanStage> root, stage_builder::PlanStageData data)
@@ -161,6 +161,8 @@ std::vector<plan_ranker::CandidatePlan> BaseRuntimePlanner::collectExecutionStat
     // plans which could artificially favor the blocking plans.
     const size_t trackerResultsBudget = nonBlockingPlanIndexes.empty() ? maxNumResults : 0;
 
+    // Each finished candidate lowers 'maxNumReads', so a later candidate which cannot beat the
+    // best plan seen so far is cut off by its TrialRunTracker before the full trial budget.
     auto runPlans = [&](const std::vector<size_t>& planIndexes, size_t& maxNumReads) -> void {
         for (auto planIndex : planIndexes) {
             // Prepare the plan.
@@ -532,6 +532,10 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateOptimizedOplo
  *  - Else if 'isTailableResumeBranch' is true, the scan will start from a RecordId contained in
  * slot "resumeRecordId".
  *  - Otherwise the scan will start from the beginning of the collection.
+ *
+ * The scan is always built as a single ScanStage. Splitting it with a ParallelScanStage under an
+ * ExchangeConsumer is not done, since the exchange producers run on operation contexts of their
+ * own, which share neither this query's storage snapshot nor its deadline and killOp.
  */
 std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateGenericCollScan(
     StageBuilderState& state,
@@ -198,6 +198,11 @@ private:
      * Stage function that executes a query to retrieve all documents in the collection.  For each
      * batch returned by the upstream node, handleNextBatch will be called with the data.  This
      * stage will finish when the entire query is finished or failed.
+     *
+     * The collection is copied by a single query. Resuming after a sync source failure depends on
+     * a single '_resumeToken' and the documents are fed to one CollectionBulkLoader, whose index
+     * builds are not safe for concurrent inserts, so range-partitioned parallel cloning would need
+     * a per-range loader and resume state.
      */
     AfterStageBehavior queryStage();
 
@@ -56,6 +56,7 @@
 #include "mongo/db/repl/idempotency_test_fixture.h"
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/repl/oplog_applier_utils.h"
 #include "mongo/db/repl/oplog_entry_test_helpers.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
@@ -539,6 +540,26 @@ TEST_F(OplogApplierImplTest,
                   secondDerivedOp.getObject()["lastWriteOpTime"]["ts"].timestamp());
 }
 
+TEST(WriterLoadBalancerTest, KeepsHashOnOneWriterAndSpreadsNewHashesByLoad) {
+    WriterLoadBalancer balancer(3);
+
+    // Each new hash goes to the least loaded writer.
+    ASSERT_EQUALS(0U, balancer.assign(10, 100));
+    ASSERT_EQUALS(1U, balancer.assign(11, 10));
+    ASSERT_EQUALS(2U, balancer.assign(12, 10));
+
+    // Ops with a hash that was already seen stay on its writer, however loaded it is.
+    ASSERT_EQUALS(0U, balancer.assign(10, 100));
+
+    // Ops with new hashes avoid the heavily loaded writer.
+    ASSERT_EQUALS(1U, balancer.assign(13, 50));
+    ASSERT_EQUALS(2U, balancer.assign(14, 10));
+
+    ASSERT_EQUALS(200U, balancer.load()[0]);
+    ASSERT_EQUALS(60U, balancer.load()[1]);
+    ASSERT_EQUALS(20U, balancer.load()[2]);
+}
+
 class MultiOplogEntryOplogApplierImplTest : public OplogApplierImplTest {
 public:
     MultiOplogEntryOplogApplierImplTest()
@@ -38,6 +38,7 @@
 #include "mongo/db/repl/oplog_applier.h"
 #include "mongo/db/repl/oplog_batcher_test_fixture.h"
 #include "mongo/db/repl/oplog_buffer_blocking_queue.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/unittest.h"
 
 namespace mongo {
@@ -358,6 +359,86 @@ TEST_F(OplogApplierTest, LastOpInLargeTransactionIsProcessedIndividually) {
     ASSERT_EQUALS(srcOps[4], batch[0]);
 }
 
+TEST_F(OplogApplierTest, AdaptiveBatchLimitIsNotUsedWithoutTarget) {
+    RAIIServerParameterControllerForTest limitOps("replBatchLimitOperations", 1000);
+    OplogBatcher batcher(_applier.get(), _buffer.get());
+
+    batcher.onBatchApplied(1000, Seconds(10));
+    ASSERT_EQUALS(1000U, batcher.getBatchLimitOps());
+}
+
+TEST_F(OplogApplierTest, AdaptiveBatchLimitShrinksAfterSlowBatch) {
+    RAIIServerParameterControllerForTest limitOps("replBatchLimitOperations", 1000);
+    RAIIServerParameterControllerForTest targetMillis("replBatchTargetApplyMillis", 100);
+    OplogBatcher batcher(_applier.get(), _buffer.get());
+    ASSERT_EQUALS(1000U, batcher.getBatchLimitOps());
+
+    // 1000 entries took 400ms, so 250 entries would have been applied within the target.
+    batcher.onBatchApplied(1000, Milliseconds(400));
+    ASSERT_EQUALS(250U, batcher.getBatchLimitOps());
+
+    // A batch which is slower still never shrinks the limit below its lower bound.
+    batcher.onBatchApplied(250, Seconds(10));
+    ASSERT_EQUALS(100U, batcher.getBatchLimitOps());
+}
+
+TEST_F(OplogApplierTest, AdaptiveBatchLimitGrowsAfterFastFullBatch) {
+    RAIIServerParameterControllerForTest limitOps("replBatchLimitOperations", 1000);
+    RAIIServerParameterControllerForTest targetMillis("replBatchTargetApplyMillis", 100);
+    OplogBatcher batcher(_applier.get(), _buffer.get());
+
+    batcher.onBatchApplied(1000, Milliseconds(400));
+    ASSERT_EQUALS(250U, batcher.getBatchLimitOps());
+
+    // A fast batch which did not fill the limit leaves it unchanged.
+    batcher.onBatchApplied(200, Milliseconds(10));
+    ASSERT_EQUALS(250U, batcher.getBatchLimitOps());
+
+    // A fast full batch grows the limit by a quarter.
+    batcher.onBatchApplied(250, Milliseconds(10));
+    ASSERT_EQUALS(312U, batcher.getBatchLimitOps());
+    batcher.onBatchApplied(312, Milliseconds(10));
+    ASSERT_EQUALS(390U, batcher.getBatchLimitOps());
+}
+
+TEST_F(OplogApplierTest, AdaptiveBatchLimitDoesNotGrowPastUpperBound) {
+    RAIIServerParameterControllerForTest limitOps("replBatchLimitOperations", 900 * 1000);
+    RAIIServerParameterControllerForTest targetMillis("replBatchTargetApplyMillis", 100);
+    OplogBatcher batcher(_applier.get(), _buffer.get());
+
+    batcher.onBatchApplied(900 * 1000, Milliseconds(10));
+    ASSERT_EQUALS(1000U * 1000U, batcher.getBatchLimitOps());
+
+    batcher.onBatchApplied(1000 * 1000, Milliseconds(10));
+    ASSERT_EQUALS(1000U * 1000U, batcher.getBatchLimitOps());
+}
+
+TEST_F(OplogApplierTest, AdaptiveBatchLimitIgnoresSingleEntryBatches) {
+    RAIIServerParameterControllerForTest limitOps("replBatchLimitOperations", 1000);
+    RAIIServerParameterControllerForTest targetMillis("replBatchTargetApplyMillis", 100);
+    OplogBatcher batcher(_applier.get(), _buffer.get());
+
+    batcher.onBatchApplied(1, Seconds(10));
+    ASSERT_EQUALS(1000U, batcher.getBatchLimitOps());
+}
+
+TEST_F(OplogApplierTest, AdaptiveBatchLimitResetsWhenTargetIsCleared) {
+    RAIIServerParameterControllerForTest limitOps("replBatchLimitOperations", 1000);
+    OplogBatcher batcher(_applier.get(), _buffer.get());
+    {
+        RAIIServerParameterControllerForTest targetMillis("replBatchTargetApplyMillis", 100);
+        batcher.onBatchApplied(1000, Milliseconds(400));
+        ASSERT_EQUALS(250U, batcher.getBatchLimitOps());
+    }
+
+    // Without a target the configured limit applies again.
+    ASSERT_EQUALS(1000U, batcher.getBatchLimitOps());
+
+    // Re-enabling adaptive sizing starts over from the configured limit.
+    RAIIServerParameterControllerForTest targetMillis("replBatchTargetApplyMillis", 100);
+    ASSERT_EQUALS(1000U, batcher.getBatchLimitOps());
+}
+
 }  // namespace
 }  // namespace repl
 }  // namespace mongo
@@ -31,6 +31,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/document_validation.h"
@@ -101,12 +103,22 @@ void OplogApplierUtils::processCrudOp(OperationContext* opCtx,
     }
 }
 
+uint32_t WriterLoadBalancer::assign(uint32_t hash, size_t cost) {
+    auto [it, inserted] = _writerForHash.try_emplace(hash, 0);
+    if (inserted) {
+        it->second = std::distance(_load.begin(), std::min_element(_load.begin(), _load.end()));
+    }
+    _load[it->second] += cost;
+    return it->second;
+}
+
 uint32_t OplogApplierUtils::addToWriterVector(
     OperationContext* opCtx,
     OplogEntry* op,
     std::vector<std::vector<const OplogEntry*>>* writerVectors,
     CachedCollectionProperties* collPropertiesCache,
-    boost::optional<uint32_t> forceWriterId) {
+    boost::optional<uint32_t> forceWriterId,
+    WriterLoadBalancer* loadBalancer) {
     auto hashedNs = StringMapHasher().hashed_key(op->getNss().ns());
 
     // Reduce the hash from 64bit down to 32bit, just to allow combinations with murmur3 later
@@ -118,7 +130,14 @@ uint32_t OplogApplierUtils::addToWriterVector(
         processCrudOp(opCtx, op, &hash, &hashedNs, collPropertiesCache);
 
     const uint32_t numWriters = writerVectors->size();
-    auto writerId = (forceWriterId ? *forceWriterId : hash) % numWriters;
+    uint32_t writerId;
+    if (forceWriterId) {
+        writerId = *forceWriterId % numWriters;
+    } else if (loadBalancer) {
+        writerId = loadBalancer->assign(hash, op->getRawObjSizeBytes());
+    } else {
+        writerId = hash % numWriters;
+    }
     auto& writer = (*writerVectors)[writerId];
     if (writer.empty()) {
         writer.reserve(8);  // Skip a few growth rounds
@@ -148,13 +167,14 @@ void OplogApplierUtils::addDerivedOps(OperationContext* opCtx,
                                       std::vector<OplogEntry>* derivedOps,
                                       std::vector<std::vector<const OplogEntry*>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      bool serial) {
+                                      bool serial,
+                                      WriterLoadBalancer* loadBalancer) {
     boost::optional<uint32_t>
         serialWriterId;  // Used to determine which writer vector to assign serial ops.
 
     for (auto&& op : *derivedOps) {
-        auto writerId =
-            addToWriterVector(opCtx, &op, writerVectors, collPropertiesCache, serialWriterId);
+        auto writerId = addToWriterVector(
+            opCtx, &op, writerVectors, collPropertiesCache, serialWriterId, loadBalancer);
         if (serial && !serialWriterId) {
             serialWriterId.emplace(writerId);
         }
@@ -29,7 +29,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include "mongo/db/repl/insert_group.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
 class CollatorInterface;
@@ -58,6 +61,35 @@ private:
     StringMap<CollectionProperties> _cache;
 };
 
+/**
+ * Balances the ops of a batch across writer threads. The first op with a given writer hash is
+ * assigned to the writer with the least estimated work so far; every later op with the same hash
+ * goes to that same writer, which preserves the ordering guarantees of hash-based assignment. The
+ * work of an op is estimated from its size in the oplog. One instance must be used for a whole
+ * batch.
+ */
+class WriterLoadBalancer {
+public:
+    explicit WriterLoadBalancer(size_t numWriters) : _load(numWriters, 0) {}
+
+    /**
+     * Returns the writer that the op with the given hash and estimated cost should be added to,
+     * and accounts for its cost on that writer.
+     */
+    uint32_t assign(uint32_t hash, size_t cost);
+
+    /**
+     * The estimated work assigned to each writer so far.
+     */
+    const std::vector<size_t>& load() const {
+        return _load;
+    }
+
+private:
+    std::vector<size_t> _load;
+    stdx::unordered_map<uint32_t, uint32_t> _writerForHash;
+};
+
 /**
  * This class contains some static methods common to ordinary oplog application and oplog
  * application as part of tenant migration.
@@ -85,13 +117,15 @@ public:
 
     /**
      * Adds a single oplog entry to the appropriate writer vector.  Returns the index of the
-     * writer vector the entry was written to.
+     * writer vector the entry was written to. If 'loadBalancer' is provided, it picks the writer
+     * instead of the hash.
      */
     static uint32_t addToWriterVector(OperationContext* opCtx,
                                       OplogEntry* op,
                                       std::vector<std::vector<const OplogEntry*>>* writerVectors,
                                       CachedCollectionProperties* collPropertiesCache,
-                                      boost::optional<uint32_t> forceWriterId = boost::none);
+                                      boost::optional<uint32_t> forceWriterId = boost::none,
+                                      WriterLoadBalancer* loadBalancer = nullptr);
     /**
      * Adds a set of derivedOps to writerVectors.
      * If `serial` is true, assign all derived operations to the writer vector corresponding to the
@@ -101,7 +135,8 @@ public:
                               std::vector<OplogEntry>* derivedOps,
                               std::vector<std::vector<const OplogEntry*>>* writerVectors,
                               CachedCollectionProperties* collPropertiesCache,
-                              bool serial);
+                              bool serial,
+                              WriterLoadBalancer* loadBalancer = nullptr);
 
     /**
      * Returns the namespace string for this oplogEntry; if it has a UUID it looks up the
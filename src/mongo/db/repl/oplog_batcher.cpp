@@ -31,7 +31,10 @@
 
 #include "mongo/db/repl/oplog_batcher.h"
 
+#include <algorithm>
+
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/commands/txn_cmds_gen.h"
 #include "mongo/db/repl/oplog_applier.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
@@ -41,6 +44,31 @@ namespace mongo {
 namespace repl {
 MONGO_FAIL_POINT_DEFINE(skipOplogBatcherWaitForData);
 
+namespace {
+
+// Bounds on the entries-per-batch limit chosen by adaptive batch sizing. The upper bound matches
+// the largest value accepted for 'replBatchLimitOperations'.
+constexpr long long kMinAdaptiveBatchLimitOps = 100;
+constexpr long long kMaxAdaptiveBatchLimitOps = 1000 * 1000;
+
+AtomicWord<long long> adaptiveBatchLimitOps{0};
+
+/**
+ * Reports the entries-per-batch limit currently chosen by adaptive batch sizing, or 0 when
+ * adaptive batch sizing is not in use.
+ */
+class AdaptiveBatchLimitMetric final : public ServerStatusMetric {
+public:
+    using ServerStatusMetric::ServerStatusMetric;
+
+    void appendAtLeaf(BSONObjBuilder& b) const final {
+        b.append(_leafName, adaptiveBatchLimitOps.load());
+    }
+};
+AdaptiveBatchLimitMetric displayAdaptiveBatchLimitOps("repl.apply.adaptiveBatchLimitOps");
+
+}  // namespace
+
 OplogBatcher::OplogBatcher(OplogApplier* oplogApplier, OplogBuffer* oplogBuffer)
     : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _ops(0) {}
 OplogBatcher::~OplogBatcher() {
@@ -262,7 +290,7 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
         batchLimits.slaveDelayLatestTimestamp = _calculateSlaveDelayLatestTimestamp();
 
         // Check the limits once per batch since users can change them at runtime.
-        batchLimits.ops = getBatchLimitOplogEntries();
+        batchLimits.ops = getBatchLimitOps();
 
         // Use the OplogBuffer to populate a local OplogBatch. Note that the buffer may be empty.
         OplogBatch ops(batchLimits.ops);
@@ -282,8 +310,10 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
 
             auto oplogEntries =
                 fassertNoTrace(31004, getNextApplierBatch(opCtx.get(), batchLimits));
-            for (const auto& oplogEntry : oplogEntries) {
-                ops.emplace_back(oplogEntry);
+            // Move rather than copy: each OplogEntry owns a parsed DurableOplogEntry and copying
+            // it re-allocates every owned sub-object for no benefit.
+            for (auto& oplogEntry : oplogEntries) {
+                ops.emplace_back(std::move(oplogEntry));
             }
 
             // If we don't have anything in the batch, wait a bit for something to appear.
@@ -340,6 +370,46 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
     }
 }
 
+void OplogBatcher::onBatchApplied(std::size_t numEntries, Milliseconds duration) {
+    const long long targetMillis = replBatchTargetApplyMillis.load();
+    // Batches of a single entry are mostly commands, which are always applied on their own and
+    // say nothing about how many entries fit in a batch.
+    if (targetMillis <= 0 || numEntries <= 1) {
+        return;
+    }
+
+    auto limit = _adaptiveBatchLimitOps.load();
+    if (limit == 0) {
+        limit = getBatchLimitOplogEntries();
+    }
+
+    const long long entries = numEntries;
+    const long long elapsedMillis = durationCount<Milliseconds>(duration);
+    if (elapsedMillis > targetMillis) {
+        // Shrink to the number of entries that would have been applied within the target.
+        limit = std::max(kMinAdaptiveBatchLimitOps, entries * targetMillis / elapsedMillis);
+    } else if (entries >= limit) {
+        // A full batch was applied within the target, so more entries were likely waiting. Grow
+        // gradually so that a single fast batch does not overshoot.
+        limit = std::min(kMaxAdaptiveBatchLimitOps, limit + std::max(1LL, limit / 4));
+    }
+
+    _adaptiveBatchLimitOps.store(limit);
+    adaptiveBatchLimitOps.store(limit);
+}
+
+std::size_t OplogBatcher::getBatchLimitOps() {
+    if (replBatchTargetApplyMillis.load() <= 0) {
+        // Start over from the configured limit if adaptive batch sizing is enabled again.
+        _adaptiveBatchLimitOps.store(0);
+        adaptiveBatchLimitOps.store(0);
+        return getBatchLimitOplogEntries();
+    }
+
+    const auto limit = _adaptiveBatchLimitOps.load();
+    return limit ? std::size_t(limit) : getBatchLimitOplogEntries();
+}
+
 std::size_t getBatchLimitOplogEntries() {
     return std::size_t(replBatchLimitOperations.load());
 }
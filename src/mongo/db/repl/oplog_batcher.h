@@ -173,6 +173,19 @@ public:
     StatusWith<std::vector<OplogEntry>> getNextApplierBatch(OperationContext* opCtx,
                                                             const BatchLimits& batchLimits);
 
+    /**
+     * Reports that the applier took 'duration' to apply a batch of 'numEntries' oplog entries.
+     * When 'replBatchTargetApplyMillis' is set, this feedback adjusts the number of entries allowed
+     * in later batches so that applying a batch takes about that long.
+     */
+    void onBatchApplied(std::size_t numEntries, Milliseconds duration);
+
+    /**
+     * Returns the maximum number of entries for the next batch, taking adaptive batch sizing into
+     * account.
+     */
+    std::size_t getBatchLimitOps();
+
     /**
      * Helper method indicating that this oplog entry must be in a batch of its own.
      */
@@ -211,6 +224,10 @@ private:
     OplogBatch _ops;
 
     std::unique_ptr<stdx::thread> _thread;
+
+    // The entries-per-batch limit chosen by adaptive batch sizing, or 0 if it is not in use.
+    // Updated by the applier thread and read by the batcher thread.
+    AtomicWord<long long> _adaptiveBatchLimitOps{0};
 };
 
 /**
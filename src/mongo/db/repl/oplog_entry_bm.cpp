@@ -0,0 +1,115 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/repl/oplog_entry.h"
+#include "mongo/util/uuid.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+constexpr int kBatchSize = 1000;
+
+BSONObj makeOplogEntryBSON(StringData opType, int i) {
+    BSONObjBuilder bob;
+    bob.append("ts", Timestamp(1, i));
+    bob.append("t", 1LL);
+    bob.append("v", 2);
+    bob.append("op", opType);
+    bob.append("ns", "test.coll");
+    UUID::gen().appendToBuilder(&bob, "ui");
+    bob.append("wall", Date_t());
+    if (opType == "u") {
+        bob.append("o", BSON("$v" << 1 << "$set" << BSON("x" << i)));
+        bob.append("o2", BSON("_id" << i));
+    } else {
+        bob.append("o", BSON("_id" << i << "x" << i << "s" << "some string payload"));
+    }
+    return bob.obj();
+}
+
+void BM_ParseOplogEntry(benchmark::State& state, StringData opType) {
+    auto obj = makeOplogEntryBSON(opType, 1);
+    for (auto _ : state) {
+        OplogEntry entry(obj);
+        benchmark::DoNotOptimize(entry);
+    }
+}
+
+std::vector<OplogEntry> makeBatch() {
+    std::vector<OplogEntry> batch;
+    batch.reserve(kBatchSize);
+    for (int i = 0; i < kBatchSize; ++i) {
+        batch.emplace_back(makeOplogEntryBSON("i", i));
+    }
+    return batch;
+}
+
+void BM_CopyOplogBatch(benchmark::State& state) {
+    auto batch = makeBatch();
+    for (auto _ : state) {
+        std::vector<OplogEntry> out;
+        out.reserve(batch.size());
+        for (const auto& entry : batch) {
+            out.emplace_back(entry);
+        }
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+void BM_MoveOplogBatch(benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto batch = makeBatch();
+        state.ResumeTiming();
+        std::vector<OplogEntry> out;
+        out.reserve(batch.size());
+        for (auto& entry : batch) {
+            out.emplace_back(std::move(entry));
+        }
+        benchmark::DoNotOptimize(out);
+    }
+    state.SetItemsProcessed(state.iterations() * kBatchSize);
+}
+
+BENCHMARK_CAPTURE(BM_ParseOplogEntry, Insert, "i"_sd);
+BENCHMARK_CAPTURE(BM_ParseOplogEntry, Update, "u"_sd);
+BENCHMARK(BM_CopyOplogBatch);
+BENCHMARK(BM_MoveOplogBatch);
+
+}  // namespace
+}  // namespace repl
+}  // namespace mongo
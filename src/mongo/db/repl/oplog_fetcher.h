@@ -490,7 +490,10 @@ private:
     // via its shutdownAndDisallowReconnect function.
     std::unique_ptr<DBClientConnection> _conn;
 
-    // Used to create the DBClientConnection for the oplog fetcher.
+    // Used to create the DBClientConnection for the oplog fetcher. The connection negotiates the
+    // node's configured network message compressors (net.compression.compressors, which include
+    // zstd by default) with the sync source, so oplog batches are sent compressed. There is no
+    // oplog-specific encoding, as it would have to be understood by every version of sync source.
     CreateClientFn _createClientFn;
 
     // The tailable, awaitData, exhaust cursor used to fetch oplog entries from the sync source.
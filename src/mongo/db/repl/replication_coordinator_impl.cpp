@@ -4725,10 +4725,36 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
+    // Waiters are visited in opTime order, and a write concern that is not yet satisfied at some
+    // opTime cannot be satisfied at any later one. So once a waiter is found unsatisfied, later
+    // waiters with an equivalent write concern are skipped without consulting the topology again.
+    // With many concurrent writers sharing a few write concerns, this keeps the cost of each
+    // progress update close to the number of waiters it releases.
+    std::vector<const WriteConcernOptions*> unsatisfiedWriteConcerns;
+    auto isKnownUnsatisfied = [&](const WriteConcernOptions& writeConcern) {
+        return std::any_of(unsatisfiedWriteConcerns.begin(),
+                           unsatisfiedWriteConcerns.end(),
+                           [&](const WriteConcernOptions* unsatisfied) {
+                               return writeConcern.syncMode == unsatisfied->syncMode &&
+                                   writeConcern.wMode == unsatisfied->wMode &&
+                                   writeConcern.wNumNodes == unsatisfied->wNumNodes &&
+                                   writeConcern.checkCondition == unsatisfied->checkCondition;
+                           });
+    };
+
     _replicationWaiterList.setValueIf_inlock(
-        [this](const OpTime& opTime, const SharedWaiterHandle& waiter) {
+        [&](const OpTime& opTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
-            return _doneWaitingForReplication_inlock(opTime, waiter->writeConcern.get());
+            const auto& writeConcern = waiter->writeConcern.get();
+            if (isKnownUnsatisfied(writeConcern)) {
+                return false;
+            }
+            if (_doneWaitingForReplication_inlock(opTime, writeConcern)) {
+                return true;
+            }
+            // Unsatisfied waiters stay in the list, so this pointer remains valid.
+            unsatisfiedWriteConcerns.push_back(&writeConcern);
+            return false;
         },
         opTime);
 }
@@ -69,13 +69,31 @@ namespace {
 const auto kRecoveryBatchLogLevel = logv2::LogSeverity::Debug(2);
 const auto kRecoveryOperationLogLevel = logv2::LogSeverity::Debug(3);
 
+// Minimum interval between the progress messages logged while replaying the oplog for recovery.
+const int kRecoveryProgressLogIntervalSecs = 10;
+
 /**
  * Tracks and logs operations applied during recovery.
  */
 class RecoveryOplogApplierStats : public OplogApplier::Observer {
 public:
+    explicit RecoveryOplogApplierStats(Timestamp endPoint) : _endPoint(endPoint) {}
+
     void onBatchBegin(const std::vector<OplogEntry>& batch) final {
         _numBatches++;
+
+        // Batch-level messages are only logged at a debug level, so report progress periodically
+        // for long recoveries.
+        if (_sinceProgressLogged.seconds() >= kRecoveryProgressLogIntervalSecs) {
+            LOGV2(5859506,
+                  "Oplog application for recovery in progress",
+                  "numOpsApplied"_attr = _numOpsApplied,
+                  "numBatches"_attr = _numBatches,
+                  "nextOpTime"_attr = batch.front().getOpTime(),
+                  "endPoint"_attr = _endPoint);
+            _sinceProgressLogged.reset();
+        }
+
         LOGV2_FOR_RECOVERY(24098,
                            kRecoveryBatchLogLevel.toInt(),
                            "Applying operations in batch: {numBatches}({batchSize} operations "
@@ -120,6 +138,8 @@ public:
     }
 
 private:
+    const Timestamp _endPoint;
+    Timer _sinceProgressLogged;
     std::size_t _numBatches = 0;
     std::size_t _numOpsApplied = 0;
 };
@@ -668,7 +688,7 @@ Timestamp ReplicationRecoveryImpl::_applyOplogOperations(OperationContext* opCtx
     OplogBufferLocalOplog oplogBuffer(startPoint, endPoint);
     oplogBuffer.startup(opCtx);
 
-    RecoveryOplogApplierStats stats;
+    RecoveryOplogApplierStats stats(endPoint);
 
     auto writerPool = makeReplWriterPool();
     auto* replCoord = ReplicationCoordinator::get(opCtx);
@@ -445,6 +445,9 @@ private:
      * This function causes the server to terminate if an error occurs while fetching documents from
      * disk or while writing documents to the rollback file. It must be called before marking the
      * oplog truncate point, and before the storage engine recovers to the stable timestamp.
+     * Because the documents it saves are discarded by that recovery, the files cannot be written
+     * in the background while rollback proceeds. Oplog replay after recovery already applies
+     * batches in parallel through OplogApplierImpl's writer pool (see ReplicationRecovery).
      */
     Status _writeRollbackFiles(OperationContext* opCtx);
 
@@ -46,6 +46,12 @@ namespace repl {
  * provides functions to create oplog entries that would contain the writes to update
  * config.transactions.
  *
+ * Within an oplog application batch only the latest retryable write for each session and txnNumber
+ * is kept, so a session's config.transactions entry is written once per batch for each txnNumber,
+ * however many of its writes the batch contains. Updates are not coalesced across txnNumbers. On
+ * the primary, OpObserverImpl::onInserts likewise updates the entry once for a whole batch of
+ * inserts.
+ *
  * Assumption: it is not allowed to do transactions/retryable writes against config.transactions.
  */
 class SessionUpdateTracker {
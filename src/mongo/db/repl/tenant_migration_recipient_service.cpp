@@ -394,6 +394,9 @@ boost::optional<BSONObj> TenantMigrationRecipientService::Instance::reportForCur
     if (_tenantOplogApplier) {
         bob.appendNumber("numOpsApplied",
                          static_cast<long long>(_tenantOplogApplier->getNumOpsApplied()));
+        bob.append(
+            "applierRecipientLagThrottleMillis",
+            durationCount<Milliseconds>(_tenantOplogApplier->getRecipientLagThrottleTime()));
     }
 
     return bob.obj();
@@ -48,6 +48,7 @@
 #include "mongo/db/repl/oplog_applier_utils.h"
 #include "mongo/db/repl/repl_client_info.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/session_update_tracker.h"
 #include "mongo/db/repl/tenant_migration_decoration.h"
 #include "mongo/db/repl/tenant_migration_recipient_service.h"
@@ -63,6 +64,11 @@ namespace repl {
 MONGO_FAIL_POINT_DEFINE(hangInTenantOplogApplication);
 MONGO_FAIL_POINT_DEFINE(fpBeforeTenantOplogApplyingBatch);
 
+namespace {
+// How often the applier re-checks the recipient's replication lag while it is throttled.
+constexpr Milliseconds kRecipientLagRecheckInterval{100};
+}  // namespace
+
 TenantOplogApplier::TenantOplogApplier(const UUID& migrationUuid,
                                        const std::string& tenantId,
                                        OpTime applyFromOpTime,
@@ -196,7 +202,8 @@ void TenantOplogApplier::_applyLoop(TenantOplogBatch batch) {
     std::move(nextBatchFuture)
         .thenRunOn(_executor)
         .then([this, self = shared_from_this()](TenantOplogBatch batch) {
-            _applyLoop(std::move(batch));
+            return _waitForRecipientLag().then(
+                [this, self, batch = std::move(batch)]() mutable { _applyLoop(std::move(batch)); });
         })
         .onError([this, self = shared_from_this()](Status status) {
             invariant(_shouldStopApplying(status));
@@ -204,6 +211,39 @@ void TenantOplogApplier::_applyLoop(TenantOplogBatch batch) {
         .getAsync([](auto status) {});
 }
 
+ExecutorFuture<void> TenantOplogApplier::_waitForRecipientLag() {
+    const auto maxLagSecs = tenantApplierMaxRecipientLagSecs.load();
+    if (maxLagSecs == 0) {
+        return ExecutorFuture<void>(_executor);
+    }
+
+    auto replCoord = ReplicationCoordinator::get(getGlobalServiceContext());
+    const auto lag = replCoord->getMyLastAppliedOpTimeAndWallTime().wallTime -
+        replCoord->getLastCommittedOpTimeAndWallTime().wallTime;
+    if (lag <= Seconds(maxLagSecs)) {
+        return ExecutorFuture<void>(_executor);
+    }
+
+    {
+        stdx::lock_guard lk(_mutex);
+        if (!_isActive_inlock() || _isShuttingDown_inlock()) {
+            return ExecutorFuture<void>(_executor);
+        }
+        _recipientLagThrottleTime += kRecipientLagRecheckInterval;
+    }
+
+    LOGV2_DEBUG(5859400,
+                2,
+                "Tenant oplog applier waiting for recipient replication lag to drop",
+                "tenant"_attr = _tenantId,
+                "migrationUuid"_attr = _migrationUuid,
+                "lag"_attr = duration_cast<Milliseconds>(lag),
+                "maxLagSecs"_attr = maxLagSecs);
+
+    return _executor->sleepFor(kRecipientLagRecheckInterval, CancellationToken::uncancelable())
+        .then([this, self = shared_from_this()] { return _waitForRecipientLag(); });
+}
+
 bool TenantOplogApplier::_shouldStopApplying(Status status) {
     {
         stdx::lock_guard lk(_mutex);
@@ -95,6 +95,15 @@ public:
         return _numOpsApplied;
     }
 
+    /**
+     * Returns the total time the applier has held off applying batches because the recipient's
+     * majority commit point lagged by more than tenantApplierMaxRecipientLagSecs.
+     */
+    Milliseconds getRecipientLagThrottleTime() {
+        stdx::lock_guard lk(_mutex);
+        return _recipientLagThrottleTime;
+    }
+
     /**
      * This should only be called once before the applier starts.
      */
@@ -143,6 +152,13 @@ private:
      */
     void _setFinalStatusIfOk(WithLock, Status newStatus);
 
+    /**
+     * Returns a future that becomes ready once the recipient's majority commit point is within
+     * tenantApplierMaxRecipientLagSecs of its last applied optime, or immediately when the
+     * throttle is disabled or the applier is shutting down.
+     */
+    ExecutorFuture<void> _waitForRecipientLag();
+
     Mutex* _getMutex() noexcept final {
         return &_mutex;
     }
@@ -181,6 +197,7 @@ private:
     stdx::unordered_set<UUID, UUID::Hash> _knownGoodUuids;                // (X)
     bool _applyLoopApplyingBatch = false;                                 // (M)
     size_t _numOpsApplied{0};                                             // (M)
+    Milliseconds _recipientLagThrottleTime{0};                            // (M)
 };
 
 /**
@@ -125,6 +125,7 @@ public:
         // to start each test case from a clean state.
         tenantApplierBatchSizeBytes.store(kTenantApplierBatchSizeBytesDefault);
         tenantApplierBatchSizeOps.store(kTenantApplierBatchSizeOpsDefault);
+        tenantApplierMaxRecipientLagSecs.store(kTenantApplierMaxRecipientLagSecsDefault);
 
         // Set up an OpObserver to track the documents OplogApplierImpl inserts.
         auto service = getServiceContext();
@@ -1203,5 +1204,56 @@ TEST_F(TenantOplogApplierTest, ApplyResumeTokenInsertThenNoop_Success) {
     applier->join();
 }
 
+TEST_F(TenantOplogApplierTest, ApplierWaitsWhileRecipientLags) {
+    std::vector<OplogEntry> srcOps;
+    srcOps.push_back(makeInsertOplogEntry(1, NamespaceString(dbName, "foo"), UUID::gen()));
+    pushOps(srcOps);
+    auto writerPool = makeTenantMigrationWriterPool();
+
+    // The mock's majority commit point is always at the epoch, so holding the last applied wall
+    // time ten seconds past it makes the recipient lag by more than the one second allowed. The
+    // optime is the largest possible so that the applier's own writes don't move it forward.
+    tenantApplierMaxRecipientLagSecs.store(1);
+    auto replCoord =
+        dynamic_cast<ReplicationCoordinatorMock*>(ReplicationCoordinator::get(_opCtx.get()));
+    replCoord->setMyLastAppliedOpTimeAndWallTime({OpTime::max(), Date_t() + Seconds(10)});
+
+    auto applier = std::make_shared<TenantOplogApplier>(
+        _migrationUuid, _tenantId, OpTime(), &_oplogBuffer, _executor, writerPool.get());
+    ASSERT_OK(applier->startup());
+    auto opAppliedFuture = applier->getNotificationForOpTime(srcOps[0].getOpTime());
+
+    auto waitForThrottleTime = [&](Milliseconds expected) {
+        while (applier->getRecipientLagThrottleTime() < expected) {
+            sleepmillis(1);
+        }
+    };
+    auto advanceToNextRecheck = [&] {
+        executor::NetworkInterfaceMock::InNetworkGuard guard(_net);
+        _net->advanceTime(_net->now() + Milliseconds(100));
+    };
+
+    // The batch is held back, and the applier re-checks the lag after each interval.
+    waitForThrottleTime(Milliseconds(100));
+    advanceToNextRecheck();
+    waitForThrottleTime(Milliseconds(200));
+    ASSERT_FALSE(opAppliedFuture.isReady());
+    ASSERT_EQ(0, _opObserver->getEntries().size());
+    ASSERT_EQ(0, applier->getNumOpsApplied());
+
+    // Once the recipient catches up, the batch is applied at the next check.
+    replCoord->setMyLastAppliedOpTimeAndWallTime({OpTime::max(), Date_t()});
+    advanceToNextRecheck();
+    ASSERT_OK(opAppliedFuture.getNoThrow().getStatus());
+
+    auto entries = _opObserver->getEntries();
+    ASSERT_EQ(1, entries.size());
+    assertNoOpMatches(srcOps[0], entries[0]);
+    ASSERT_EQ(Milliseconds(200), applier->getRecipientLagThrottleTime());
+
+    applier->shutdown();
+    applier->join();
+}
+
 }  // namespace repl
 }  // namespace mongo
@@ -234,7 +234,9 @@ public:
      *
      * The usedShards parameter is in/out and it contains the set of shards, which have already been
      * used for migrations. Used so we don't return multiple conflicting migrations for the same
-     * shard.
+     * shard. This is a hard limit rather than a tunable one: each shard's ActiveMigrationsRegistry
+     * admits a single donate or receive at a time, so a second move involving the same shard would
+     * only fail with ConflictingOperationInProgress.
      */
     static std::vector<MigrateInfo> balance(const ShardStatisticsVector& shardStats,
                                             const DistributionStatus& distribution,
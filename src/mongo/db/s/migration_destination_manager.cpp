@@ -453,10 +453,26 @@ repl::OpTime MigrationDestinationManager::fetchAndApplyBatch(
     std::function<bool(OperationContext*, BSONObj)> applyBatchFn,
     std::function<bool(OperationContext*, BSONObj*)> fetchBatchFn) {
 
-    SingleProducerSingleConsumerQueue<BSONObj>::Options options;
-    options.maxQueueDepth = 1;
+    // Bounds the batches buffered ahead of the applier either by count (one batch) or, when
+    // migrateCloneMaxBufferedBytes is set, by their total size. The byte bound never drops below
+    // the largest possible batch, so that the queue always admits at least one.
+    struct BatchCost {
+        size_t operator()(const BSONObj& batch) const {
+            return byBytes ? batch.objsize() : 1;
+        }
+        bool byBytes = false;
+    };
+
+    SingleProducerSingleConsumerQueue<BSONObj, BatchCost>::Options options;
+    const auto maxBufferedBytes = migrateCloneMaxBufferedBytes.load();
+    if (maxBufferedBytes > 0) {
+        options.costFunc.byBytes = true;
+        options.maxQueueDepth = std::max(maxBufferedBytes, BSONObjMaxInternalSize);
+    } else {
+        options.maxQueueDepth = 1;
+    }
 
-    SingleProducerSingleConsumerQueue<BSONObj> batches(options);
+    SingleProducerSingleConsumerQueue<BSONObj, BatchCost> batches(options);
     repl::OpTime lastOpApplied;
 
     stdx::thread applicationThread{[&] {
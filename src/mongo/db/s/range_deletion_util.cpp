@@ -172,6 +172,9 @@ StatusWith<int> deleteNextBatch(OperationContext* opCtx,
                             "namespace"_attr = nss.ns());
     }
 
+    // Orphans are deleted one document at a time rather than by truncating key and record ranges:
+    // records are not clustered by shard key, so the range maps to scattered RecordIds, and each
+    // delete must still produce its own fromMigrate oplog entry for secondaries to apply.
     auto deleteStageParams = std::make_unique<DeleteStageParams>();
     deleteStageParams->fromMigrate = true;
     deleteStageParams->isMulti = true;
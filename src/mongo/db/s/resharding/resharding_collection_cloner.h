@@ -58,6 +58,10 @@ class ServiceContext;
 /**
  * Responsible for copying data from multiple source shards that will belong to this shard based on
  * the new resharding chunk distribution.
+ *
+ * All donors are read through a single pipeline whose results are merged in _id order, because
+ * the cloner resumes after a failover from the highest _id already present in the temporary
+ * collection. Cloning sub-ranges in parallel would need a resume point per sub-range instead.
  */
 class ReshardingCollectionCloner {
 public:
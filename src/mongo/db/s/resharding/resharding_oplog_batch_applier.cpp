@@ -67,11 +67,13 @@ SemiFuture<void> ReshardingOplogBatchApplier::applyBatch(
                [this, chainCtx, cancelToken, factory] {
                    // Writing `auto& i = chainCtx->nextToApply` takes care of incrementing
                    // chainCtx->nextToApply on each loop iteration.
-                   for (auto& i = chainCtx->nextToApply; i < chainCtx->batch.size(); ++i) {
-                       const auto& oplogEntry = *chainCtx->batch[i];
-                       auto opCtx = factory.makeOperationContext(&cc());
+                   if constexpr (IsForSessionApplication) {
+                       for (auto& i = chainCtx->nextToApply; i < chainCtx->batch.size(); ++i) {
+                           const auto& oplogEntry = *chainCtx->batch[i];
+                           // Each entry checks out its own session, which needs a fresh
+                           // OperationContext.
+                           auto opCtx = factory.makeOperationContext(&cc());
 
-                       if constexpr (IsForSessionApplication) {
                            auto hitPreparedTxn =
                                _sessionApplication.tryApplyOperation(opCtx.get(), oplogEntry);
 
@@ -79,18 +81,25 @@ SemiFuture<void> ReshardingOplogBatchApplier::applyBatch(
                                return future_util::withCancellation(std::move(*hitPreparedTxn),
                                                                     cancelToken);
                            }
-                       } else {
-                           // ReshardingOpObserver depends on the collection metadata being known
-                           // when processing writes to the temporary resharding collection. We
-                           // attach shard version IGNORED to the insert operations and retry once
-                           // on a StaleConfig exception to allow the collection metadata
-                           // information to be recovered.
-                           auto& oss = OperationShardingState::get(opCtx.get());
-                           oss.initializeClientRoutingVersions(
-                               _crudApplication.getOutputNss(),
-                               ChunkVersion::IGNORED() /* shardVersion */,
-                               boost::none /* dbVersion */);
+                       }
+                   } else {
+                       // CRUD entries carry no session state, so a single OperationContext is
+                       // reused for the whole batch rather than one being created per entry.
+                       auto opCtx = factory.makeOperationContext(&cc());
 
+                       // ReshardingOpObserver depends on the collection metadata being known
+                       // when processing writes to the temporary resharding collection. We
+                       // attach shard version IGNORED to the insert operations and retry once
+                       // on a StaleConfig exception to allow the collection metadata
+                       // information to be recovered.
+                       auto& oss = OperationShardingState::get(opCtx.get());
+                       oss.initializeClientRoutingVersions(
+                           _crudApplication.getOutputNss(),
+                           ChunkVersion::IGNORED() /* shardVersion */,
+                           boost::none /* dbVersion */);
+
+                       for (auto& i = chainCtx->nextToApply; i < chainCtx->batch.size(); ++i) {
+                           const auto& oplogEntry = *chainCtx->batch[i];
                            resharding::data_copy::withOneStaleConfigRetry(opCtx.get(), [&] {
                                uassertStatusOK(
                                    _crudApplication.applyOperation(opCtx.get(), oplogEntry));
@@ -37,6 +37,11 @@ namespace mongo {
 
 /**
  * Test fixture class for tests that use the "ephemeralForTest" storage engine.
+ *
+ * This is a unittest fixture, so the storage engine setup it performs is not available to
+ * Google Benchmark targets. The '*_bm.cpp' targets therefore measure components in isolation; a
+ * benchmark of a full command path over a real storage engine needs that setup factored out of
+ * this fixture first.
  */
 class ServiceContextMongoDTest : public virtual ServiceContextTest {
 public:
@@ -171,7 +171,10 @@ private:
                          SessionRuntimeInfo* parentSri,
                          boost::optional<KillToken> killToken);
 
-    // Protects the state below
+    // Protects the state below. A single mutex is used, rather than one per partition of the map,
+    // because checking out a child session also checks out its parent in the same critical
+    // section, and the two may hash to different partitions. Waiters for a session block on that
+    // session's condition variable with this mutex, so it is held only briefly per checkout.
     mutable Mutex _mutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(4), "SessionCatalog::_mutex");
 
@@ -49,6 +49,7 @@
 #include "mongo/db/sorter/sorter.h"
 
 #include <boost/filesystem/operations.hpp>
+#include <cstring>
 #include <snappy.h>
 #include <vector>
 
@@ -272,18 +273,36 @@ private:
      */
     void _fillBufferFromDisk() {
         int32_t rawSize;
-        _read(&rawSize, sizeof(rawSize));
-        if (_done)
-            return;
+        if (_nextBlockRawSize) {
+            rawSize = *_nextBlockRawSize;
+            _nextBlockRawSize = boost::none;
+        } else {
+            _read(&rawSize, sizeof(rawSize));
+            if (_done)
+                return;
+        }
 
         // negative size means compressed
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
-        _buffer.reset(new char[blockSize]);
-        _read(_buffer.get(), blockSize);
+        // Read ahead the size of the following block together with this one so that, during the
+        // merge phase, each block costs a single seek and read of the file shared by all
+        // iterators rather than two.
+        const std::streamoff nextSizeEndOffset = _fileCurrentOffset + blockSize + sizeof(int32_t);
+        const bool readAheadNextSize = nextSizeEndOffset <= _fileEndOffset;
+        const size_t readSize = blockSize + (readAheadNextSize ? sizeof(int32_t) : 0);
+
+        _buffer.reset(new char[readSize]);
+        _read(_buffer.get(), readSize);
         uassert(16816, "file too short?", !_done);
 
+        if (readAheadNextSize) {
+            int32_t nextRawSize;
+            std::memcpy(&nextRawSize, _buffer.get() + blockSize, sizeof(nextRawSize));
+            _nextBlockRawSize = nextRawSize;
+        }
+
         if (auto encryptionHooks = getEncryptionHooksIfEnabled()) {
             std::unique_ptr<char[]> out(new char[blockSize]);
             size_t outLen;
@@ -345,6 +364,7 @@ private:
 
     std::unique_ptr<char[]> _buffer;
     std::unique_ptr<BufReader> _bufferReader;
+    boost::optional<int32_t> _nextBlockRawSize;  // Size header of the next block, if read ahead.
     std::shared_ptr<typename Sorter<Key, Value>::File>
         _file;                          // File containing the sorted data range.
     std::streamoff _fileStartOffset;    // File offset at which the sorted data range starts.
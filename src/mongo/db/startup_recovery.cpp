@@ -58,6 +58,7 @@
 #include "mongo/util/exit.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/quick_exit.h"
+#include "mongo/util/timer.h"
 
 #if !defined(_WIN32)
 #include <sys/file.h>
@@ -562,7 +563,11 @@ void startupRecovery(OperationContext* opCtx,
 
     // Drops abandoned idents. Rebuilds unfinished indexes and restarts incomplete two-phase
     // index builds.
+    Timer timer;
     reconcileCatalogAndRebuildUnfinishedIndexes(opCtx, storageEngine, lastShutdownState);
+    LOGV2(5859504,
+          "Reconciled the catalog and rebuilt unfinished indexes",
+          "duration"_attr = Milliseconds(timer.millis()));
 
     const auto& replSettings = repl::ReplicationCoordinator::get(opCtx)->getSettings();
 
@@ -572,6 +577,7 @@ void startupRecovery(OperationContext* opCtx,
     const bool shouldClearNonLocalTmpCollections =
         !(hasReplSetConfigDoc(opCtx) || replSettings.usingReplSets());
 
+    timer.reset();
     openDatabases(opCtx, storageEngine, [&](auto db) {
         auto dbName = db->name();
 
@@ -593,6 +599,9 @@ void startupRecovery(OperationContext* opCtx,
             db->clearTmpCollections(opCtx);
         }
     });
+    LOGV2(5859505,
+          "Opened databases and checked collection properties",
+          "duration"_attr = Milliseconds(timer.millis()));
 }
 
 }  // namespace
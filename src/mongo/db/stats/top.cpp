@@ -203,19 +203,19 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
     if (!opCtx->shouldIncrementLatencyStats())
         return;
 
-    stdx::lock_guard<SimpleMutex> guard(_lock);
+    stdx::lock_guard<SimpleMutex> guard(_globalHistogramLock);
     _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
                                    BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
+    stdx::lock_guard<SimpleMutex> guard(_globalHistogramLock);
     _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
+    stdx::lock_guard<SimpleMutex> guard(_globalHistogramLock);
     _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
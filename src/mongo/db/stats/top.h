@@ -47,6 +47,12 @@ class ServiceContext;
 
 /**
  * tracks usage by collection
+ *
+ * This is the only always-on aggregate of operation statistics, and it is keyed by namespace, not
+ * by query shape. Per-shape figures are only available per operation, through the 'queryHash' and
+ * 'planCacheKey' that OpDebug reports to the profiler and the slow query log. A per-shape store
+ * would follow the same pattern as this class, recording from the end of each operation into a
+ * bounded map exposed by an aggregation stage the way '$collStats' exposes 'latencyStats'.
  */
 class Top {
 public:
@@ -153,9 +159,14 @@ private:
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
+    // Guards '_usage'.
     mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
     UsageMap _usage;
+
+    // Every user operation records into '_globalHistogramStats', so it has its own mutex rather
+    // than contending with per-collection recording and with readers cloning '_usage'.
+    mutable SimpleMutex _globalHistogramLock;
+    OperationLatencyHistogram _globalHistogramStats;
 };
 
 }  // namespace mongo
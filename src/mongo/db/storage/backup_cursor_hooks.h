@@ -39,6 +39,13 @@ class OperationContext;
 class ServiceContext;
 class StorageEngine;
 
+/**
+ * Extension point for backup cursors. The implementation in this tree is disabled; a real one is
+ * registered through registerInitializer(). It opens the storage engine's backup cursor, which
+ * already returns incremental block ranges (see StorageEngine::BackupBlock), and decides how the
+ * files or blocks are delivered. Server-side streaming of file contents therefore belongs in the
+ * registered implementation rather than here.
+ */
 class BackupCursorHooks {
 public:
     using InitializerFunction = std::function<std::unique_ptr<BackupCursorHooks>(StorageEngine*)>;
@@ -113,6 +113,10 @@ void Checkpointer::run() {
 
         const Date_t startTime = Date_t::now();
 
+        // The amount written here depends on how much dirty data has built up in the cache since
+        // the previous checkpoint, which is governed by WiredTiger's eviction targets (see
+        // 'wiredTigerEvictionDirtyTargetGB') rather than by this thread. The duration and size
+        // of each checkpoint are reported in WiredTiger's statistics, which FTDC collects.
         // TODO SERVER-50861: Access the storage engine via the ServiceContext.
         _kvEngine->checkpoint();
 
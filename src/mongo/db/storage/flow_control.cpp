@@ -244,6 +244,9 @@ void FlowControl::_updateTopologyData() {
               });
 }
 
+// The allowance is derived from the apply rate of the sustainer, the median member by applied
+// optime, rather than from the lag alone. Tickets are taken with the global IX lock, before the
+// operation's namespace is known, so the throttle necessarily applies to all writers alike.
 int FlowControl::_calculateNewTicketsForLag(const std::vector<repl::MemberData>& prevMemberData,
                                             const std::vector<repl::MemberData>& currMemberData,
                                             std::int64_t locksUsedLastPeriod,
@@ -2559,7 +2559,12 @@ int compare(const char* leftBuf, const char* rightBuf, size_t leftSize, size_t r
     else if (MONGO_unlikely(rightSize == 0))
         return 1;
 
-    int min = std::min(leftSize, rightSize);
+    // KeyStrings are compared as plain byte strings, which lets memcmp find the first difference.
+    // The libc implementation is already vectorized, so keys sharing long prefixes (e.g. compound
+    // keys with common leading strings) are scanned many bytes at a time. We deliberately do not
+    // prefix-compress keys in sorter runs: resumable index builds persist those runs and resume
+    // reading them after a restart, so their on-disk format must stay stable.
+    const size_t min = std::min(leftSize, rightSize);
 
     int cmp = memcmp(leftBuf, rightBuf, min);
 
@@ -207,6 +207,34 @@ void BM_KeyStringStackBuilderCopy(benchmark::State& state, BsonValueType bsonTyp
     state.SetItemsProcessed(state.iterations() * kSampleSize);
 }
 
+void BM_KeyStringCompareSharedPrefix(benchmark::State& state) {
+    // Compound keys whose leading string components are identical, as is common for index builds
+    // on compound indexes, so that every comparison has to scan a long common prefix.
+    const auto version = KeyString::Version::V1;
+    const Ordering ordering = Ordering::make(BSON("a" << 1 << "b" << 1 << "c" << 1));
+    const std::string prefix(state.range(0), 'x');
+
+    std::vector<KeyString::Value> values;
+    int64_t keystringSize = 0;
+    for (int i = 0; i < kSampleSize; i++) {
+        KeyString::HeapBuilder builder(
+            version, BSON("" << prefix << "" << prefix << "" << i), ordering);
+        values.emplace_back(builder.release());
+        keystringSize += values.back().getSize();
+    }
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (size_t i = 1; i < kSampleSize; i++) {
+            benchmark::DoNotOptimize(values[i - 1].compare(values[i]));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * keystringSize);
+    state.SetItemsProcessed(state.iterations() * (kSampleSize - 1));
+}
+
+BENCHMARK(BM_KeyStringCompareSharedPrefix)->Arg(8)->Arg(64)->Arg(512);
+
 BENCHMARK_CAPTURE(BM_KeyStringValueAssign, Int, INT);
 BENCHMARK_CAPTURE(BM_KeyStringValueAssign, Double, DOUBLE);
 BENCHMARK_CAPTURE(BM_KeyStringValueAssign, Decimal, DECIMAL);
@@ -56,6 +56,7 @@
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
+#include "mongo/util/timer.h"
 
 #define LOGV2_FOR_RECOVERY(ID, DLEVEL, MESSAGE, ...) \
     LOGV2_DEBUG_OPTIONS(ID, DLEVEL, {logv2::LogComponent::kStorageRecovery}, MESSAGE, ##__VA_ARGS__)
@@ -99,9 +100,11 @@ StorageEngineImpl::StorageEngineImpl(OperationContext* opCtx,
     // recover these orphaned idents.
     invariant(!opCtx->lockState()->isLocked());
     Lock::GlobalWrite globalLk(opCtx);
+    Timer timer;
     loadCatalog(opCtx,
                 _options.lockFileCreatedByUncleanShutdown ? LastShutdownState::kUnclean
                                                           : LastShutdownState::kClean);
+    LOGV2(5859503, "Loaded the durable catalog", "duration"_attr = Milliseconds(timer.millis()));
 }
 
 void StorageEngineImpl::loadCatalog(OperationContext* opCtx, LastShutdownState lastShutdownState) {
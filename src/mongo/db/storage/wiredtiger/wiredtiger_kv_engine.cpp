@@ -259,6 +259,9 @@ std::string toString(const StorageEngine::OldestActiveTransactionTimestampResult
 }
 
 namespace {
+// Sized by the wiredTigerConcurrent{Read,Write}Transactions parameters. Shrinking a pool blocks in
+// TicketHolder::resize() until enough tickets are returned, so anything that retunes these at
+// runtime must do it from a thread that may wait behind the operations holding them.
 TicketHolder openWriteTransaction(128);
 TicketHolder openReadTransaction(128);
 }  // namespace
@@ -349,6 +352,9 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
 
     std::stringstream ss;
     ss << "create,";
+    // The cache always starts cold. Preloading hot ranges after a restart would require knowing
+    // which collections and indexes those idents belong to, and the engine has no view of the
+    // catalog or of query-level index usage, so warming is left to the workload.
     ss << "cache_size=" << cacheSizeMB << "M,";
     ss << "session_max=33000,";
     ss << "eviction=(threads_min=4,threads_max=4),";
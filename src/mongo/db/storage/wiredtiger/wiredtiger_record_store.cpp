@@ -1297,6 +1297,12 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
         }
     }
 
+    // Look up the per-operation state used by every iteration once for the whole batch.
+    auto* metricsCollector =
+        _isOplog ? nullptr : &ResourceConsumption::MetricsCollector::get(opCtx);
+    RecoveryUnit* ru = opCtx->recoveryUnit();
+    Timestamp lastSetTs;
+
     for (size_t i = 0; i < nRecords; i++) {
         auto& record = records[i];
         invariant(!record.id.isNull());
@@ -1310,13 +1316,16 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
             // journal flush is bypassed. A followup oplog read will require a fresh visibility
             // value to make progress.
             ts = Timestamp(record.id.getLong());
-            opCtx->recoveryUnit()->setOrderedCommit(false);
+            ru->setOrderedCommit(false);
         } else {
             ts = timestamps[i];
         }
-        if (!ts.isNull()) {
+        // Batches commonly share a single timestamp, so only re-timestamp the transaction when it
+        // changes.
+        if (!ts.isNull() && ts != lastSetTs) {
             LOGV2_DEBUG(22403, 4, "inserting record with timestamp {ts}", "ts"_attr = ts);
-            fassert(39001, opCtx->recoveryUnit()->setTimestamp(ts));
+            fassert(39001, ru->setTimestamp(ts));
+            lastSetTs = ts;
         }
         CursorKey key = makeCursorKey(record.id, _keyFormat);
         setKey(c, &key);
@@ -1343,9 +1352,8 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
 
         // Increment metrics for each insert separately, as opposed to outside of the loop. The API
         // requires that each record be accounted for separately.
-        if (!_isOplog) {
-            auto& metricsCollector = ResourceConsumption::MetricsCollector::get(opCtx);
-            metricsCollector.incrementOneDocWritten(value.size);
+        if (metricsCollector) {
+            metricsCollector->incrementOneDocWritten(value.size);
         }
     }
 
@@ -1532,7 +1540,9 @@ StatusWith<RecordData> WiredTigerRecordStore::updateWithDamages(
     const RecordData& oldRec,
     const char* damageSource,
     const mutablebson::DamageVector& damages) {
-
+    // Each damage event maps directly onto one WT_MODIFY entry, so in-place updates never diff the
+    // old and new values. wiredtiger_calc_modify() is only used by updateRecord(), for updates that
+    // change the document's binary layout and therefore cannot be expressed as damages.
     const int nentries = damages.size();
     mutablebson::DamageVector::const_iterator where = damages.begin();
     const mutablebson::DamageVector::const_iterator end = damages.cend();
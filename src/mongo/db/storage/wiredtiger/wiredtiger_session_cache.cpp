@@ -33,9 +33,11 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/global_settings.h"
 #include "mongo/db/repl/repl_settings.h"
@@ -46,6 +48,8 @@
 #include "mongo/logv2/log.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -325,6 +329,9 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
         token = journalListener->getToken(opCtx);
     }
 
+    _durabilityWaiters.fetchAndAddRelaxed(1);
+    _waitersSinceLastFlush.fetchAndAdd(1);
+
     uint32_t start = _lastSyncTime.load();
     // Do the remainder in a critical section that ensures only a single thread at a time
     // will attempt to synchronize.
@@ -332,10 +339,34 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
     uint32_t current = _lastSyncTime.loadRelaxed();  // synchronized with writes through mutex
     if (current != start) {
         // Someone else synced already since we read lastSyncTime, so we're done!
+        _durabilityWaitersSharingAFlush.fetchAndAddRelaxed(1);
         return;
     }
+
+    // Group commit: before claiming this sync, give writers that are about to wait for durability
+    // a chance to be covered by it. Anyone who reads '_lastSyncTime' before it is bumped below
+    // will queue on the mutex and return as soon as our flush completes. The delay adapts to the
+    // observed flush latency so that fast storage is not slowed down by a fixed wait.
+    const bool isJournaled = _engine && _engine->isDurable();
+    const long long maxDelayMicros = gWiredTigerJournalGroupCommitMaxDelayMicros.load();
+    if (isJournaled && maxDelayMicros > 0) {
+        const long long delayMicros = std::min(maxDelayMicros, _lastFlushMicros.loadRelaxed());
+        if (delayMicros > 0) {
+            sleepmicros(delayMicros);
+            _totalGroupCommitDelayMicros.fetchAndAddRelaxed(delayMicros);
+        }
+    }
+
     _lastSyncTime.store(current + 1);
 
+    // Everyone who arrived since the previous flush is covered by this one.
+    const long long batchSize = std::max(1LL, _waitersSinceLastFlush.swap(0));
+    size_t bucket = 0;
+    for (long long n = batchSize; n > 1 && bucket + 1 < kNumFlushBatchSizeBuckets; n >>= 1) {
+        ++bucket;
+    }
+    _flushBatchSizes[bucket].fetchAndAddRelaxed(1);
+
     // Nobody has synched yet, so we have to sync ourselves.
 
     // Initialize on first use.
@@ -345,19 +376,40 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
     }
 
     // Use the journal when available, or a checkpoint otherwise.
-    if (_engine && _engine->isDurable()) {
+    Timer flushTimer;
+    if (isJournaled) {
         invariantWTOK(_waitUntilDurableSession->log_flush(_waitUntilDurableSession, "sync=on"));
         LOGV2_DEBUG(22419, 4, "flushed journal");
     } else {
         invariantWTOK(_waitUntilDurableSession->checkpoint(_waitUntilDurableSession, nullptr));
         LOGV2_DEBUG(22420, 4, "created checkpoint");
     }
+    const long long flushMicros = flushTimer.micros();
+    _flushes.fetchAndAddRelaxed(1);
+    _totalFlushMicros.fetchAndAddRelaxed(flushMicros);
+    _lastFlushMicros.store(flushMicros);
 
     if (token) {
         journalListener->onDurable(token.get());
     }
 }
 
+void WiredTigerSessionCache::appendGroupCommitStats(BSONObjBuilder* builder) const {
+    builder->append("flushes", _flushes.load());
+    builder->append("waiters", _durabilityWaiters.load());
+    builder->append("waiters sharing a flush", _durabilityWaitersSharingAFlush.load());
+    builder->append("total flush micros", _totalFlushMicros.load());
+    builder->append("last flush micros", _lastFlushMicros.load());
+    builder->append("total group commit delay micros", _totalGroupCommitDelayMicros.load());
+
+    static constexpr std::array<StringData, kNumFlushBatchSizeBuckets> kBucketNames = {
+        "1"_sd, "2-3"_sd, "4-7"_sd, "8-15"_sd, "16-31"_sd, "32+"_sd};
+    BSONObjBuilder batchSizes(builder->subobjStart("flush batch sizes"));
+    for (size_t i = 0; i < kNumFlushBatchSizeBuckets; ++i) {
+        batchSizes.append(kBucketNames[i], _flushBatchSizes[i].load());
+    }
+}
+
 void WiredTigerSessionCache::waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx,
                                                                         std::uint64_t lastCount) {
     invariant(opCtx);
@@ -376,10 +428,27 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 }
 
 
+size_t WiredTigerSessionCache::_shardForCurrentThread() {
+    static AtomicWord<unsigned> nextShard{0};
+    thread_local const size_t shard = nextShard.fetchAndAdd(1) % kNumSessionCacheShards;
+    return shard;
+}
+
+std::vector<stdx::unique_lock<Latch>> WiredTigerSessionCache::_lockAllShards() {
+    std::vector<stdx::unique_lock<Latch>> locks;
+    locks.reserve(_shards.size());
+    for (auto&& shard : _shards) {
+        locks.emplace_back(shard.lock);
+    }
+    return locks;
+}
+
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto&& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        for (auto session : shard.sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -387,15 +456,21 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (auto&& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        for (auto session : shard.sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto&& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        count += shard.sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -407,14 +482,14 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (auto&& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = shard.sessions.begin(); it != shard.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = shard.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
@@ -434,9 +509,14 @@ void WiredTigerSessionCache::closeAll() {
     SessionCache swap;
 
     {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        // Hold every shard's lock while bumping the epoch, so that no session from the old epoch
+        // can be returned to any shard after it has been emptied.
+        auto locks = _lockAllShards();
         _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+        for (auto&& shard : _shards) {
+            swap.insert(swap.end(), shard.sessions.begin(), shard.sessions.end());
+            shard.sessions.clear();
+        }
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -453,13 +533,16 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
+    // Look in this thread's own shard first, then steal from the others.
+    const size_t homeShard = _shardForCurrentThread();
+    for (size_t i = 0; i < kNumSessionCacheShards; ++i) {
+        auto& shard = _shards[(homeShard + i) % kNumSessionCacheShards];
+        stdx::lock_guard<Latch> lock(shard.lock);
+        if (!shard.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = shard.sessions.back();
+            shard.sessions.pop_back();
             // Reset the idle time
             cachedSession->setIdleExpireTime(Date_t::min());
             return UniqueWiredTigerSession(cachedSession);
@@ -521,10 +604,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& shard = _shards[_shardForCurrentThread()];
+        stdx::lock_guard<Latch> lock(shard.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            shard.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -29,8 +29,10 @@
 
 #pragma once
 
+#include <array>
 #include <list>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -39,9 +41,11 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/with_alignment.h"
 
 namespace mongo {
 
+class BSONObjBuilder;
 class WiredTigerKVEngine;
 class WiredTigerSessionCache;
 
@@ -322,6 +326,13 @@ public:
      */
     void waitUntilDurable(OperationContext* opCtx, Fsync syncType, UseJournalListener useListener);
 
+    /**
+     * Appends statistics describing how the journal flushes issued by waitUntilDurable() have been
+     * shared between concurrent waiters: the number of flushes, how many waiters were satisfied
+     * by a flush another thread issued, flush latencies and a histogram of flush batch sizes.
+     */
+    void appendGroupCommitStats(BSONObjBuilder* builder) const;
+
     /**
      * Waits until a prepared unit of work has ended (either been commited or aborted). This
      * should be used when encountering WT_PREPARE_CONFLICT errors. The caller is required to retry
@@ -379,9 +390,29 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // Idle sessions are kept in several independently locked free lists, so that threads checking
+    // sessions in and out do not all serialize on a single mutex. Each thread prefers its own
+    // shard, and steals from the others only when its own is empty.
+    struct SessionCacheShard {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
+        SessionCache sessions;
+    };
+    static constexpr size_t kNumSessionCacheShards = 16;
+
+    /**
+     * Returns the index of the shard the calling thread checks sessions in and out of first.
+     * Threads are assigned shards round-robin the first time they ask.
+     */
+    static size_t _shardForCurrentThread();
+
+    /**
+     * Locks every shard, in ascending order, and returns the locks.
+     */
+    std::vector<stdx::unique_lock<Latch>> _lockAllShards();
+
+    std::array<CacheAligned<SessionCacheShard>, kNumSessionCacheShards> _shards;
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
@@ -393,6 +424,19 @@ private:
     AtomicWord<unsigned> _lastSyncTime;
     Mutex _lastSyncMutex = MONGO_MAKE_LATCH("WiredTigerSessionCache::_lastSyncMutex");
 
+    // Group commit statistics for waitUntilDurable. The number of waiters which arrived since the
+    // previous flush is exchanged for zero by each flushing thread to compute its batch size.
+    // Batch sizes are bucketed by powers of two: 1, 2-3, 4-7, 8-15, 16-31 and 32 or more.
+    static constexpr size_t kNumFlushBatchSizeBuckets = 6;
+    AtomicWord<long long> _waitersSinceLastFlush{0};
+    AtomicWord<long long> _durabilityWaiters{0};
+    AtomicWord<long long> _durabilityWaitersSharingAFlush{0};
+    AtomicWord<long long> _flushes{0};
+    AtomicWord<long long> _totalFlushMicros{0};
+    AtomicWord<long long> _lastFlushMicros{0};
+    AtomicWord<long long> _totalGroupCommitDelayMicros{0};
+    std::array<AtomicWord<long long>, kNumFlushBatchSizeBuckets> _flushBatchSizes{};
+
     // Mutex and cond var for waiting on prepare commit or abort.
     Mutex _prepareCommittedOrAbortedMutex =
         MONGO_MAKE_LATCH("WiredTigerSessionCache::_prepareCommittedOrAbortedMutex");
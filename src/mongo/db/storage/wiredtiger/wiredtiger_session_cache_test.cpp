@@ -33,9 +33,11 @@
 #include <string>
 
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_cursor.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/system_clock_source.h"
@@ -114,4 +116,51 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, SessionReleasedOnOneThreadIsReusedOnAnother) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    // Release a session from another thread, so it lands in that thread's shard of the cache.
+    WiredTigerSession* released = nullptr;
+    stdx::thread([&] {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        released = session.get();
+    }).join();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    // Checking out a session on this thread steals the idle session rather than opening a new one.
+    {
+        UniqueWiredTigerSession session = sessionCache->getSession();
+        ASSERT_EQUALS(session.get(), released);
+        ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    // Closing all sessions empties every shard.
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
+TEST(WiredTigerSessionCacheTest, WaitUntilDurableReportsGroupCommitStats) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    // Without an engine there is no journal, so each wait is satisfied by a checkpoint of its own.
+    for (int i = 0; i < 3; ++i) {
+        sessionCache->waitUntilDurable(nullptr,
+                                       WiredTigerSessionCache::Fsync::kJournal,
+                                       WiredTigerSessionCache::UseJournalListener::kSkip);
+    }
+
+    BSONObjBuilder builder;
+    sessionCache->appendGroupCommitStats(&builder);
+    BSONObj stats = builder.obj();
+    ASSERT_EQUALS(stats["flushes"].numberLong(), 3);
+    ASSERT_EQUALS(stats["waiters"].numberLong(), 3);
+    ASSERT_EQUALS(stats["waiters sharing a flush"].numberLong(), 0);
+    ASSERT_EQUALS(stats["total group commit delay micros"].numberLong(), 0);
+    ASSERT_EQUALS(stats["flush batch sizes"]["1"].numberLong(), 3);
+    ASSERT_EQUALS(stats["flush batch sizes"]["2-3"].numberLong(), 0);
+}
+
 }  // namespace mongo
@@ -31,6 +31,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <wiredtiger.h>
 
 #include "mongo/bson/bsonobj.h"
@@ -38,12 +39,14 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -137,6 +140,8 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
 
     Timer t;
     stdx::lock_guard<Latch> cursorLock(_cursorMutex);
+    const size_t numEntries = buffer.size();
+    size_t numBatches = 0;
     {
         // On failure, place entries back into the map, unless a newer value already exists.
         ON_BLOCK_EXIT([this, &buffer]() {
@@ -148,39 +153,60 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
             }
         });
 
+        // Write the entries in bounded batches, each in its own transaction, so that nodes with
+        // very many collections do not build one huge transaction on every checkpoint. Only the
+        // last batch needs to sync, as that also makes the earlier commits durable.
+        const size_t batchSize = std::max(1, gWiredTigerSizeStorerFlushBatchSize.load());
         WT_SESSION* session = _session.getSession();
-        WiredTigerBeginTxnBlock txnOpen(session, syncToDisk ? "sync=true" : nullptr);
-
-        for (auto it = buffer.begin(); it != buffer.end(); ++it) {
-
-            // Ordering is important here: when the store method checks if the SizeInfo
-            // is dirty and it returns true, the current values of numRecords and dataSize must
-            // still be written back. So, the required order is to clear the dirty flag first.
-            SizeInfo& sizeInfo = *it->second;
-            sizeInfo._dirty.store(false);
-            BSONObj data = BSON("numRecords" << sizeInfo.numRecords.load() << "dataSize"
-                                             << sizeInfo.dataSize.load());
+        while (!buffer.empty()) {
+            Timer batchTimer;
+            const bool lastBatch = buffer.size() <= batchSize;
+            WiredTigerBeginTxnBlock txnOpen(session,
+                                            syncToDisk && lastBatch ? "sync=true" : nullptr);
+
+            auto batchEnd = buffer.begin();
+            size_t batchEntries = 0;
+            for (; batchEntries < batchSize && batchEnd != buffer.end();
+                 ++batchEntries, ++batchEnd) {
+
+                // Ordering is important here: when the store method checks if the SizeInfo
+                // is dirty and it returns true, the current values of numRecords and dataSize must
+                // still be written back. So, the required order is to clear the dirty flag first.
+                SizeInfo& sizeInfo = *batchEnd->second;
+                sizeInfo._dirty.store(false);
+                BSONObj data = BSON("numRecords" << sizeInfo.numRecords.load() << "dataSize"
+                                                 << sizeInfo.dataSize.load());
+
+                auto& uri = batchEnd->first;
+                LOGV2_DEBUG(22425,
+                            2,
+                            "WiredTigerSizeStorer::flush",
+                            "uri"_attr = uri,
+                            "data"_attr = redact(data));
+                WiredTigerItem key(uri.c_str(), uri.size());
+                WiredTigerItem value(data.objdata(), data.objsize());
+                _cursor->set_key(_cursor, key.Get());
+                _cursor->set_value(_cursor, value.Get());
+                invariantWTOK(_cursor->insert(_cursor));
+            }
+            txnOpen.done();
+            invariantWTOK(session->commit_transaction(session, nullptr));
+            buffer.erase(buffer.begin(), batchEnd);
+            ++numBatches;
 
-            auto& uri = it->first;
-            LOGV2_DEBUG(22425,
+            LOGV2_DEBUG(5859200,
                         2,
-                        "WiredTigerSizeStorer::flush",
-                        "uri"_attr = uri,
-                        "data"_attr = redact(data));
-            WiredTigerItem key(uri.c_str(), uri.size());
-            WiredTigerItem value(data.objdata(), data.objsize());
-            _cursor->set_key(_cursor, key.Get());
-            _cursor->set_value(_cursor, value.Get());
-            invariantWTOK(_cursor->insert(_cursor));
+                        "WiredTigerSizeStorer::flush batch completed",
+                        "numEntries"_attr = batchEntries,
+                        "duration"_attr = Microseconds{batchTimer.micros()});
         }
-        txnOpen.done();
-        invariantWTOK(session->commit_transaction(session, nullptr));
-        buffer.clear();
     }
 
     LOGV2_DEBUG(22426,
                 2,
                 "WiredTigerSizeStorer::flush completed",
+                "numEntries"_attr = numEntries,
+                "numBatches"_attr = numBatches,
                 "duration"_attr = Microseconds{t.micros()});
 }
 }  // namespace mongo
@@ -88,7 +88,8 @@ public:
     std::shared_ptr<SizeInfo> load(StringData uri) const;
 
     /**
-     * Writes all changes to the underlying table.
+     * Writes all changes to the underlying table, in transactions of at most
+     * 'wiredTigerSizeStorerFlushBatchSize' entries each.
      */
     void flush(bool syncToDisk);
 
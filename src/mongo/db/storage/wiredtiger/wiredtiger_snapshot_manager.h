@@ -63,6 +63,11 @@ public:
      * Starts a transaction and returns the SnapshotName used.
      *
      * Throws if there is currently no committed snapshot.
+     *
+     * The transaction is opened while holding '_committedSnapshotMutex', so it can't start on a
+     * snapshot that clearCommittedSnapshot() has already dropped. Opening it costs one
+     * begin_transaction and one read timestamp on 'session'. WiredTiger snapshots belong to a
+     * single WT_SESSION and can't be shared with other operations' sessions.
      */
     Timestamp beginTransactionOnCommittedSnapshot(
         WT_SESSION* session,
@@ -40,6 +40,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/timeseries/timeseries_options.h"
 #include "mongo/db/views/view_catalog.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point.h"
@@ -185,17 +186,22 @@ StatusWith<std::shared_ptr<BucketCatalog::WriteBatch>> BucketCatalog::insert(
     const BSONObj& doc,
     CombineWithInsertsFromOtherClients combine) {
 
+    BSONElement timeElem;
     BSONElement metadata;
-    auto metaFieldName = options.getMetaField();
-    if (metaFieldName) {
-        metadata = doc[*metaFieldName];
+    if (auto metaFieldName = options.getMetaField()) {
+        // Find both fields in a single pass over the measurement.
+        std::array<BSONElement, 2> fields;
+        doc.getFields(std::array<StringData, 2>{options.getTimeField(), *metaFieldName}, &fields);
+        timeElem = fields[0];
+        metadata = fields[1];
+    } else {
+        timeElem = doc[options.getTimeField()];
     }
     auto key = BucketKey{ns, BucketMetadata{metadata, comparator}};
 
     auto stats = _getExecutionStats(ns);
     invariant(stats);
 
-    auto timeElem = doc[options.getTimeField()];
     if (!timeElem || BSONType::Date != timeElem.type()) {
         return {ErrorCodes::BadValue,
                 str::stream() << "'" << options.getTimeField() << "' must be present and contain a "
@@ -458,8 +464,12 @@ BucketCatalog::StripedMutex::ExclusiveLock::ExclusiveLock(const StripedMutex& sm
 }
 
 BucketCatalog::StripedMutex::SharedLock BucketCatalog::StripedMutex::lockShared() const {
-    static const std::hash<stdx::thread::id> hasher;
-    return SharedLock{_mutexes[hasher(stdx::this_thread::get_id()) % kNumStripes]};
+    // Threads are assigned stripes round-robin on first use rather than by hashing their id. Some
+    // standard libraries hash a thread id to its native handle, whose low bits are the same for
+    // every thread, which would send all readers to a single stripe.
+    static AtomicWord<std::size_t> nextStripe{0};
+    thread_local const std::size_t stripe = nextStripe.fetchAndAdd(1) % kNumStripes;
+    return SharedLock{_mutexes[stripe]};
 }
 
 BucketCatalog::StripedMutex::ExclusiveLock BucketCatalog::StripedMutex::lockExclusive() const {
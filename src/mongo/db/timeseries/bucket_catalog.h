@@ -55,6 +55,13 @@ class BucketCatalog {
 public:
     class Bucket;
 
+    /**
+     * Whether an insert may join a WriteBatch opened by another client. When allowed, concurrent
+     * inserts into the same bucket accumulate in one batch, committed as a single update of the
+     * bucket document by whichever client claims commit rights, and every contributing writer
+     * waits on that one result. Retryable writes and ordered inserts must disallow this, since
+     * their measurements have to be committed with their own statement ids and in their own order.
+     */
     enum class CombineWithInsertsFromOtherClients {
         kAllow,
         kDisallow,
@@ -186,6 +193,10 @@ public:
      * Returns the WriteBatch into which the document was inserted. Any caller who receives the same
      * batch may commit or abort the batch after claiming commit rights. See WriteBatch for more
      * details.
+     *
+     * Only buckets held open in memory are candidates. A bucket that has been closed, or whose
+     * catalog entry was cleared or expired, is never written to again, so measurements arriving
+     * after their bucket was closed start a new one.
      */
     StatusWith<std::shared_ptr<WriteBatch>> insert(
         OperationContext* opCtx,
@@ -82,8 +82,9 @@ void MinMaxStore::Data::setArray() {
 
 void MinMaxStore::Data::setValue(const BSONElement& elem) {
     auto requiredSize = elem.size() - elem.fieldNameSize() + 1;
-    if (_value.size < requiredSize) {
+    if (_value.capacity < requiredSize) {
         _value.buffer = std::make_unique<char[]>(requiredSize);
+        _value.capacity = requiredSize;
     }
     // Store element as BSONElement buffer but strip out the field name
     _value.buffer[0] = elem.type();
@@ -65,6 +65,7 @@ public:
     struct Value {
         std::unique_ptr<char[]> buffer;
         int size = 0;
+        int capacity = 0;
     };
 
     /**
@@ -55,6 +55,10 @@ static constexpr StringData kMetaFieldName = "metaField"_sd;
 static constexpr StringData kKeyFieldName = "key"_sd;
 static constexpr StringData kOriginalSpecFieldName = "originalSpec"_sd;
 
+// Buckets are always written in the uncompressed version. Readers such as the BucketUnpacker
+// already accept compressed buckets, whose 'data' fields hold BSONColumn binaries, but nothing
+// rewrites a bucket into that form yet: doing so on close requires the catalog to report closed
+// buckets to the writer and must be gated on FCV, since older binaries cannot read them.
 static constexpr int kTimeseriesControlDefaultVersion = 1;
 static constexpr int kTimeseriesControlCompressedVersion = 2;
 
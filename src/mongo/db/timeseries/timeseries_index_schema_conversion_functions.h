@@ -43,6 +43,11 @@ namespace mongo::timeseries {
  * Maps the time-series collection index spec 'timeseriesIndexSpecBSON' to the index schema of the
  * underlying bucket collection using the information provided in 'timeseriesOptions'.
  *
+ * Measurement fields are indexed through the bucket's 'control.min' and 'control.max' summaries,
+ * so such an index can only narrow a query to the buckets whose range covers the predicate. The
+ * buckets collection is indexed by the ordinary index access methods; there is no per-bucket
+ * summary structure, such as a Bloom filter, that could answer membership within a bucket.
+ *
  * Returns an error if the specified 'timeseriesKeyBSON' is invalid for the time-series collection.
  */
 StatusWith<BSONObj> createBucketsIndexSpecFromTimeseriesIndexSpec(
@@ -29,6 +29,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fcntl.h>
 #include <iostream>
 #include <string>
@@ -81,43 +83,79 @@ struct TrafficReaderPacket {
     MsgData::ConstView message;
 };
 
-bool readBytes(size_t toRead, char* buf, int fd) {
-    while (toRead) {
+/**
+ * Reads a file descriptor through a large buffer, so that a recording made of many small packets
+ * doesn't cost two read() system calls per packet.
+ */
+class BufferedFdReader {
+public:
+    explicit BufferedFdReader(int fd) : _fd(fd), _buf(SharedBuffer::allocate(kBufferSize)) {}
+
+    /**
+     * Copies the next 'toRead' bytes into 'out'. Returns false if the input ends first.
+     */
+    bool readBytes(size_t toRead, char* out) {
+        while (toRead) {
+            if (_pos == _end && !_fill()) {
+                return false;
+            }
+
+            auto n = std::min(toRead, _end - _pos);
+            std::memcpy(out, _buf.get() + _pos, n);
+            _pos += n;
+            out += n;
+            toRead -= n;
+        }
+
+        return true;
+    }
+
+private:
+    static constexpr size_t kBufferSize = 1024 * 1024;
+
+    bool _fill() {
+        while (true) {
 #ifdef _WIN32
-        auto r = _read(fd, buf, toRead);
+            auto r = _read(_fd, _buf.get(), kBufferSize);
 #else
-        auto r = ::read(fd, buf, toRead);
+            auto r = ::read(_fd, _buf.get(), kBufferSize);
 #endif
 
-        if (r == -1) {
-            auto pair = errnoAndDescription();
+            if (r == -1) {
+                auto pair = errnoAndDescription();
 
-            uassert(ErrorCodes::FileStreamFailed,
-                    str::stream() << "failed to read bytes: errno(" << pair.first
-                                  << ") : " << pair.second,
-                    pair.first == EINTR);
+                uassert(ErrorCodes::FileStreamFailed,
+                        str::stream() << "failed to read bytes: errno(" << pair.first
+                                      << ") : " << pair.second,
+                        pair.first == EINTR);
 
-            continue;
-        } else if (r == 0) {
-            return false;
-        }
+                continue;
+            } else if (r == 0) {
+                return false;
+            }
 
-        buf += r;
-        toRead -= r;
+            _pos = 0;
+            _end = r;
+            return true;
+        }
     }
 
-    return true;
-}
+    int _fd;
+    SharedBuffer _buf;
+    size_t _pos = 0;
+    size_t _end = 0;
+};
 
-boost::optional<TrafficReaderPacket> readPacket(char* buf, int fd) {
-    if (!readBytes(4, buf, fd)) {
+boost::optional<TrafficReaderPacket> readPacket(char* buf, BufferedFdReader& reader) {
+    if (!reader.readBytes(4, buf)) {
         return boost::none;
     }
     auto len = ConstDataView(buf).read<LittleEndian<uint32_t>>();
 
     uassert(ErrorCodes::FailedToParse, "packet too large", len < MaxMessageSizeBytes);
-    uassert(
-        ErrorCodes::FailedToParse, "could not read full packet", readBytes(len - 4, buf + 4, fd));
+    uassert(ErrorCodes::FailedToParse,
+            "could not read full packet",
+            reader.readBytes(len - 4, buf + 4));
 
     ConstDataRangeCursor cdr(buf, buf + len);
 
@@ -219,8 +257,9 @@ BSONArray trafficRecordingFileToBSONArr(const std::string& inputFile) {
 
     const ScopeGuard guard([&] { ::close(inputFd); });
 
+    BufferedFdReader reader(inputFd);
     auto buf = SharedBuffer::allocate(MaxMessageSizeBytes);
-    while (auto packet = readPacket(buf.get(), inputFd)) {
+    while (auto packet = readPacket(buf.get(), reader)) {
         BSONObjBuilder bob(builder.subobjStart());
         getBSONObjFromPacket(*packet, &bob);
         addOpType(*packet, &bob);
@@ -238,9 +277,10 @@ void trafficRecordingFileToMongoReplayFile(int inputFd, std::ostream& outputStre
     outputStream.write(optsObj.objdata(), optsObj.objsize());
 
     BSONObjBuilder bob;
+    BufferedFdReader reader(inputFd);
     auto buf = SharedBuffer::allocate(MaxMessageSizeBytes);
 
-    while (auto packet = readPacket(buf.get(), inputFd)) {
+    while (auto packet = readPacket(buf.get(), reader)) {
         getBSONObjFromPacket(*packet, &bob);
 
         auto obj = bob.asTempObj();
@@ -178,6 +178,12 @@ public:
     /**
      * Holds state for a snapshot read or multi-statement transaction in between network
      * operations.
+     *
+     * Every statement of a transaction, including commitTransaction, arrives as its own command and
+     * may run on a different thread and OperationContext, so the Locker and RecoveryUnit have to be
+     * stashed here whenever the session is checked back in. That includes the statement just
+     * before the commit. The oplog slots for an unprepared commit are already reserved in a single
+     * call when the commit writes its applyOps entries.
      */
     class TxnResources {
     public:
@@ -191,7 +191,11 @@ private:
         // Increment the metric after the TTL work has been finished.
         ON_BLOCK_EXIT([&] { ttlPasses.increment(); });
 
-        // Perform a pass for every collection and index described as being TTL.
+        // Perform a pass for every collection and index described as being TTL. Indexes are
+        // processed one at a time on this thread, and each deletion runs until every document
+        // expired at its start has been removed, so a collection with a large backlog delays the
+        // rest of the pass. Bounding the work done per index would need the deletion executor to
+        // support stopping after a batch, which the DeleteStage used below does not.
         for (const auto& [uuid, infos] : ttlInfos) {
             for (const auto& info : infos) {
                 // Skip collections that have not been made visible yet. The TTLCollectionCache
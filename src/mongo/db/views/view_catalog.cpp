@@ -724,8 +724,9 @@ StatusWith<ResolvedView> ViewCatalog::resolveView(OperationContext* opCtx,
         // Points to the name of the most resolved namespace.
         const NamespaceString* resolvedNss = &nss;
 
-        // Holds the combination of all the resolved views.
+        // Holds the combination of all the resolved views, and its total size in bytes.
         std::vector<BSONObj> resolvedPipeline;
+        int pipelineSize = 0;
 
         // If the catalog has not been tampered with, all views seen during the resolution will have
         // the same collation. As an optimization, we fill out the collation spec only once.
@@ -743,10 +744,6 @@ StatusWith<ResolvedView> ViewCatalog::resolveView(OperationContext* opCtx,
                 _lookup(opCtx, *resolvedNss, ViewCatalogLookupBehavior::kValidateDurableViews);
             if (!view) {
                 // Return error status if pipeline is too large.
-                int pipelineSize = 0;
-                for (auto obj : resolvedPipeline) {
-                    pipelineSize += obj.objsize();
-                }
                 if (pipelineSize > ViewGraph::kMaxViewPipelineSizeBytes) {
                     return {ErrorCodes::ViewPipelineMaxSizeExceeded,
                             str::stream() << "View pipeline exceeds maximum size; maximum size is "
@@ -772,6 +769,9 @@ StatusWith<ResolvedView> ViewCatalog::resolveView(OperationContext* opCtx,
             // Prepend the underlying view's pipeline to the current working pipeline.
             const std::vector<BSONObj>& toPrepend = view->pipeline();
             resolvedPipeline.insert(resolvedPipeline.begin(), toPrepend.begin(), toPrepend.end());
+            for (const auto& stage : toPrepend) {
+                pipelineSize += stage.objsize();
+            }
 
             // If the first stage is a $collStats, then we return early with the viewOn namespace.
             if (toPrepend.size() > 0 && !toPrepend[0]["$collStats"].eoo()) {
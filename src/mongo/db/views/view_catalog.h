@@ -136,6 +136,12 @@ public:
      * Resolve the views on 'nss', transforming the pipeline appropriately. This function returns a
      * fully-resolved view definition containing the backing namespace, the resolved pipeline and
      * the collation to use for the operation.
+     *
+     * Resolution only concatenates the stored BSON stages of each view in the chain; the expanded
+     * pipeline is then parsed and optimized by the aggregation that runs on the backing namespace,
+     * which also consults the plan cache using the shape of the pushed-down query. The parsed
+     * Pipeline is bound to the operation's ExpressionContext and cannot be shared across
+     * operations, so the parse and optimization work is repeated for every query on a view.
      */
     StatusWith<ResolvedView> resolveView(OperationContext* opCtx, const NamespaceString& nss) const;
 
@@ -275,7 +275,9 @@ private:
 
     std::shared_ptr<ControllerInterface> _controller;
 
-    // The global mutex for specific pool access and the generation counter
+    // The global mutex for specific pool access and the generation counter. Contention on it is
+    // spread by running several pools: each executor in a TaskExecutorPool owns its own
+    // ConnectionPool, sized on mongos by taskExecutorPoolSize.
     mutable Mutex _mutex =
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(1), "ExecutorConnectionPool::_mutex");
     PoolId _nextPoolId = 0;
@@ -252,6 +252,9 @@ private:
         bool isLocked{false};
     };
 
+    // Each RequestState holds its pooled connection exclusively until a response arrives: the
+    // server handles a connection's requests strictly one at a time, so independent requests can't
+    // be interleaved on it and matched back by responseTo.
     struct RequestState final : public std::enable_shared_from_this<RequestState> {
         using ConnectionHandle = std::shared_ptr<ConnectionPool::ConnectionHandle::element_type>;
         using WeakConnectionHandle = std::weak_ptr<ConnectionPool::ConnectionHandle::element_type>;
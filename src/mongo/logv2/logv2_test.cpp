@@ -1369,6 +1369,11 @@ TEST_F(LogV2Test, Unicode) {
         {"\xfc\xa1\xa1\xa1\xa1\xa1"_sd, "\ufffd\ufffd\ufffd\ufffd\ufffd\ufffd"_sd},
         // Invalid 3 Octet sequence, buffer ends prematurely, result is escaped
         {"\xe2\x82"_sd, "\ufffd\ufffd"_sd},
+        // Characters needing escapes after, and straddling, runs of plain ASCII longer than a word
+        {"0123456789abcdef\"quoted\\"_sd, "0123456789abcdef\"quoted\\"_sd},
+        {"0123456\n89abcdef\x7f"_sd, "0123456\n89abcdef\x7f"_sd},
+        {"plain ascii text \u00f1\xc3\x28 then more"_sd,
+         "plain ascii text \u00f1\ufffd\x28 then more"_sd},
     };
 
     auto getLastMongo = [&]() {
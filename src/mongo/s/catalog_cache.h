@@ -306,6 +306,9 @@ private:
         Mutex _mutex = MONGO_MAKE_LATCH("DatabaseCache::_mutex");
     };
 
+    // Concurrent lookups of the same namespace already share a single refresh through the
+    // ReadThroughCache. Refreshes of different namespaces are independent round-trips, because
+    // CatalogCacheLoader::getChunksSince loads one collection's chunks at a time.
     class CollectionCache : public RoutingTableHistoryCache {
     public:
         CollectionCache(ServiceContext* service,
@@ -193,7 +193,26 @@ ShardVersionMap ChunkMap::constructShardVersionMap() const {
 
 void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
     appendChunkTo(_chunkMap, chunk);
-    const auto chunkVersion = chunk->getLastmod();
+    if (_maxKeyStrings.size() < _chunkMap.size()) {
+        _maxKeyStrings.push_back(_chunkMap.back()->getMaxKeyString());
+    } else {
+        _maxKeyStrings.back() = _chunkMap.back()->getMaxKeyString();
+    }
+    dassert(_maxKeyStrings.size() == _chunkMap.size());
+
+    _updateCollectionVersion(chunk->getLastmod());
+}
+
+void ChunkMap::_appendDisjointChunks(ChunkVector::const_iterator first,
+                                     ChunkVector::const_iterator last) {
+    _chunkMap.insert(_chunkMap.end(), first, last);
+    for (auto it = first; it != last; ++it) {
+        _maxKeyStrings.push_back((*it)->getMaxKeyString());
+        _updateCollectionVersion((*it)->getLastmod());
+    }
+}
+
+void ChunkMap::_updateCollectionVersion(const ChunkVersion& chunkVersion) {
     if (_collectionVersion.isOlderThan(chunkVersion)) {
         _collectionVersion = ChunkVersion(chunkVersion.majorVersion(),
                                           chunkVersion.minorVersion(),
@@ -228,6 +247,23 @@ ChunkMap ChunkMap::createMerged(
     ChunkMap updatedChunkMap(
         getVersion().epoch(), getVersion().getTimestamp(), _chunkMap.size() + changedChunks.size());
 
+    // Copies the unchanged chunks in [chunkMapIndex, runEnd). The first of them may overlap the
+    // last chunk appended so far (a changed chunk which replaced them), so they go through
+    // appendChunk until one is kept as is. The remainder of the run is disjoint from it and is
+    // copied without comparing any bounds.
+    auto appendUnchangedChunks = [&](size_t runEnd) {
+        while (chunkMapIndex < runEnd) {
+            const auto& chunk = _chunkMap[chunkMapIndex++];
+            updatedChunkMap.appendChunk(chunk);
+            if (updatedChunkMap._chunkMap.back() == chunk)
+                break;
+        }
+
+        updatedChunkMap._appendDisjointChunks(_chunkMap.begin() + chunkMapIndex,
+                                              _chunkMap.begin() + runEnd);
+        chunkMapIndex = runEnd;
+    };
+
     while (chunkMapIndex < _chunkMap.size() || changedChunkIndex < changedChunks.size()) {
         if (chunkMapIndex >= _chunkMap.size()) {
             validateChunk(changedChunks[changedChunkIndex], getVersion());
@@ -236,7 +272,7 @@ ChunkMap ChunkMap::createMerged(
         }
 
         if (changedChunkIndex >= changedChunks.size()) {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+            appendUnchangedChunks(_chunkMap.size());
             continue;
         }
 
@@ -253,7 +289,15 @@ ChunkMap ChunkMap::createMerged(
             validateChunk(changedChunk, getVersion());
             updatedChunkMap.appendChunk(changedChunk);
         } else {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+            // None of the chunks ending at or before the changed chunk's min can overlap it, so
+            // the whole run up to the first one ending after it is copied at once.
+            const auto changedMinKeyString =
+                ShardKeyPattern::toKeyString(changedChunks[changedChunkIndex]->getMin());
+            const size_t runEnd = std::upper_bound(_maxKeyStrings.begin(),
+                                                   _maxKeyStrings.end(),
+                                                   StringData(changedMinKeyString)) -
+                _maxKeyStrings.begin();
+            appendUnchangedChunks(std::max(runEnd, chunkMapIndex + 1));
         }
     }
 
@@ -278,23 +322,14 @@ BSONObj ChunkMap::toBSON() const {
 
 ChunkMap::ChunkVector::const_iterator ChunkMap::_findIntersectingChunk(const BSONObj& shardKey,
                                                                        bool isMaxInclusive) const {
-    auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
-
-    if (!isMaxInclusive) {
-        return std::lower_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const auto& chunkInfo, const BSONObj& shardKey) {
-                                    return chunkInfo->getMaxKeyString() < shardKeyString;
-                                });
-    } else {
-        return std::upper_bound(_chunkMap.begin(),
-                                _chunkMap.end(),
-                                shardKey,
-                                [&shardKeyString](const BSONObj& shardKey, const auto& chunkInfo) {
-                                    return shardKeyString < chunkInfo->getMaxKeyString();
-                                });
-    }
+    const auto shardKeyString = ShardKeyPattern::toKeyString(shardKey);
+    const StringData key(shardKeyString);
+
+    const auto it = isMaxInclusive
+        ? std::upper_bound(_maxKeyStrings.begin(), _maxKeyStrings.end(), key)
+        : std::lower_bound(_maxKeyStrings.begin(), _maxKeyStrings.end(), key);
+
+    return _chunkMap.begin() + (it - _maxKeyStrings.begin());
 }
 
 std::pair<ChunkMap::ChunkVector::const_iterator, ChunkMap::ChunkVector::const_iterator>
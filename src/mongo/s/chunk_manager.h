@@ -82,6 +82,7 @@ public:
                       size_t initialCapacity = 0)
         : _collectionVersion(0, 0, epoch, timestamp), _collTimestamp(timestamp) {
         _chunkMap.reserve(initialCapacity);
+        _maxKeyStrings.reserve(initialCapacity);
     }
 
     size_t size() const {
@@ -130,8 +131,21 @@ private:
     std::pair<ChunkVector::const_iterator, ChunkVector::const_iterator> _overlappingBounds(
         const BSONObj& min, const BSONObj& max, bool isMaxInclusive) const;
 
+    /**
+     * Appends chunks which are known to be ordered, disjoint from each other and from the last
+     * chunk of this map, skipping the overlap checks done by appendChunk.
+     */
+    void _appendDisjointChunks(ChunkVector::const_iterator first, ChunkVector::const_iterator last);
+
+    void _updateCollectionVersion(const ChunkVersion& chunkVersion);
+
     ChunkVector _chunkMap;
 
+    // The KeyString-encoded max bound of each chunk in '_chunkMap', at the same index. Lookups
+    // binary search this contiguous array instead of dereferencing every ChunkInfo they visit. The
+    // views point into the ChunkInfos' own immutable strings, which '_chunkMap' keeps alive.
+    std::vector<StringData> _maxKeyStrings;
+
     // Max version across all chunks
     ChunkVersion _collectionVersion;
 
@@ -170,4 +170,57 @@ TEST_F(ChunkMapTest, TestEnumerateOverlappingChunks) {
     ASSERT_EQ(count, 3);
 }
 
+TEST_F(ChunkMapTest, TestMergeSplitAndMergedChunksIntoExistingMap) {
+    const OID epoch = OID::gen();
+    ChunkMap chunkMap{epoch, boost::none /* timestamp */};
+    ChunkVersion version{1, 0, epoch, boost::none /* timestamp */};
+
+    auto makeChunk = [&](BSONObj min, BSONObj max, ChunkVersion chunkVersion) {
+        return std::make_shared<ChunkInfo>(ChunkType{
+            uuid(), ChunkRange{std::move(min), std::move(max)}, chunkVersion, kThisShard});
+    };
+
+    std::vector<std::shared_ptr<ChunkInfo>> initialChunks;
+    initialChunks.push_back(makeChunk(getShardKeyPattern().globalMin(), BSON("a" << 0), version));
+    for (int i = 0; i < 10; ++i) {
+        initialChunks.push_back(
+            makeChunk(BSON("a" << i * 100), BSON("a" << (i + 1) * 100), version));
+    }
+    initialChunks.push_back(
+        makeChunk(BSON("a" << 1000), getShardKeyPattern().globalMax(), version));
+    auto initialMap = chunkMap.createMerged(initialChunks);
+    ASSERT_EQ(initialMap.size(), 12);
+
+    // Split [100, 200) in two and merge [500, 600), [600, 700) and [700, 800) into one chunk.
+    ChunkVersion splitVersion{2, 0, epoch, boost::none /* timestamp */};
+    ChunkVersion mergeVersion{2, 1, epoch, boost::none /* timestamp */};
+    auto updatedMap = initialMap.createMerged(
+        {makeChunk(BSON("a" << 100), BSON("a" << 150), splitVersion),
+         makeChunk(BSON("a" << 150), BSON("a" << 200), splitVersion),
+         makeChunk(BSON("a" << 500), BSON("a" << 800), mergeVersion)});
+
+    ASSERT_EQ(updatedMap.size(), 11);
+    ASSERT_EQ(updatedMap.getVersion(), mergeVersion);
+
+    int count = 0;
+    auto lastMax = getShardKeyPattern().globalMin();
+    updatedMap.forEach([&](const auto& chunkInfo) {
+        ASSERT_BSONOBJ_EQ(chunkInfo->getMin(), lastMax);
+        lastMax = chunkInfo->getMax();
+        count++;
+        return true;
+    });
+    ASSERT_EQ(count, 11);
+    ASSERT_BSONOBJ_EQ(lastMax, getShardKeyPattern().globalMax());
+
+    auto mergedChunk = updatedMap.findIntersectingChunk(BSON("a" << 650));
+    ASSERT(mergedChunk);
+    ASSERT_BSONOBJ_EQ(mergedChunk->getMin(), BSON("a" << 500));
+    ASSERT_BSONOBJ_EQ(mergedChunk->getMax(), BSON("a" << 800));
+
+    auto unchangedChunk = updatedMap.findIntersectingChunk(BSON("a" << 950));
+    ASSERT(unchangedChunk);
+    ASSERT_BSONOBJ_EQ(unchangedChunk->getMin(), BSON("a" << 900));
+}
+
 }  // namespace mongo
@@ -317,28 +317,32 @@ private:
         // batchSize in getMore when mongod returned less docs than the requested batchSize.
         long long fetchedCount = 0;
 
+        // The number of documents in the last batch received from this remote.
+        size_t lastBatchSize = 0;
+
         // If set to 'true', the cursor on this shard has been invalidated.
         bool invalidated = false;
     };
 
+    /**
+     * An entry of '_mergeQueue': a remote with buffered results, along with the sort key of the
+     * first document in its 'docBuffer'. The sort key is extracted once when the remote is pushed,
+     * rather than on every comparison made while the queue is reordered. It is a view into that
+     * document, which stays at the front of the remote's buffer for as long as the entry is queued.
+     */
+    struct MergeQueueEntry {
+        BSONObj sortKey;
+        size_t remoteIndex;
+    };
+
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const BSONObj& sort) : _sort(sort) {}
 
-        bool operator()(const size_t& lhs, const size_t& rhs);
+        bool operator()(const MergeQueueEntry& lhs, const MergeQueueEntry& rhs);
 
     private:
-        const std::vector<RemoteCursorData>& _remotes;
-
         const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -373,6 +377,19 @@ private:
      */
     Status _askForNextBatch(WithLock, size_t remoteIndex);
 
+    /**
+     * Asks the remote for its next batch before its buffer runs out, once half of the last batch
+     * has been returned. The request then overlaps with merging the rest of the buffer, rather
+     * than starting only once nextEvent() finds the buffer empty. Only one request is ever
+     * outstanding per remote, so this buffers at most one extra batch per remote.
+     *
+     * Only enabled by 'internalQueryPrefetchRemoteCursorBatches'. Does nothing for tailable
+     * cursors, when detached from an OperationContext, or when the operation has a deadline. A
+     * request made now would carry that deadline, and it could expire while the client is between
+     * getMores, which does not count against the cursor's maxTimeMS.
+     */
+    void _maybePrefetchNextBatch(WithLock, size_t remoteIndex);
+
     /**
      * Checks whether or not the remote cursors are all exhausted.
      */
@@ -427,6 +444,11 @@ private:
      */
     bool _addBatchToBuffer(WithLock, size_t remoteIndex, const CursorResponse& response);
 
+    /**
+     * Pushes the remote at 'remoteIndex', which must have buffered results, onto '_mergeQueue'.
+     */
+    void _pushToMergeQueue(WithLock, size_t remoteIndex);
+
     /**
      * If there is a valid unsignaled event that has been requested via nextEvent() and there are
      * buffered results that are ready to return, signals that event.
@@ -495,7 +517,8 @@ private:
 
     // The top of this priority queue is the index into '_remotes' for the remote host that has the
     // next document to return, according to the sort order. Used only if there is a sort.
-    std::priority_queue<size_t, std::vector<size_t>, MergingComparator> _mergeQueue;
+    std::priority_queue<MergeQueueEntry, std::vector<MergeQueueEntry>, MergingComparator>
+        _mergeQueue;
 
     // The index into '_remotes' for the remote from which we are currently retrieving results.
     // Used only if there is *not* a sort.
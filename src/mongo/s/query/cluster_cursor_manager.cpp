@@ -250,7 +250,7 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     AuthCheck checkSessionAuth) {
     const auto now = _clockSource->now();
 
-    stdx::lock_guard<Latch> lk(_mutex);
+    stdx::unique_lock<Latch> lk(_mutex);
     _log.push({LogEvent::Type::kCheckoutAttempt, cursorId, now, nss});
 
     if (_inShutdown) {
@@ -283,6 +283,16 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     }
 
     auto cursorGuard = entry->releaseCursor(opCtx);
+    _log.push({LogEvent::Type::kCheckoutComplete, cursorId, now, nss});
+
+    // The entry is now marked as in use by this operation, so no other thread can check it out or
+    // destroy it. Finish the checkout without holding '_mutex', which every getMore on this mongos
+    // contends on.
+    lk.unlock();
+    entry = nullptr;
+
+    cursorGuard->reattachToOperationContext(opCtx);
+    CurOp::get(opCtx)->debug().queryHash = cursorGuard->getQueryHash();
 
     // We use pinning of a cursor as a proxy for active, user-initiated use of a cursor.  Therefore,
     // we pass down to the logical session cache and vivify the record (updating last use).
@@ -290,14 +300,12 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
         auto vivifyCursorStatus =
             LogicalSessionCache::get(opCtx)->vivify(opCtx, cursorGuard->getLsid().get());
         if (!vivifyCursorStatus.isOK()) {
+            // Kill the cursor and remove its entry, which would otherwise stay marked as in use.
+            checkInCursor(cursorGuard.releaseCursor(), nss, cursorId, CursorState::Exhausted);
             return vivifyCursorStatus;
         }
     }
-    cursorGuard->reattachToOperationContext(opCtx);
 
-    CurOp::get(opCtx)->debug().queryHash = cursorGuard->getQueryHash();
-
-    _log.push({LogEvent::Type::kCheckoutComplete, cursorId, now, nss});
     return PinnedCursor(this, std::move(cursorGuard), nss, cursorId);
 }
 
@@ -288,7 +288,10 @@ CursorId runQueryWithoutRetrying(OperationContext* opCtx,
     auto requests =
         constructRequestsForShards(opCtx, cm, shardIds, query, appendGeoNearDistanceProjection);
 
-    // Establish the cursors with a consistent shardVersion across shards.
+    // Establish the cursors with a consistent shardVersion across shards. This waits for every
+    // targeted shard, even for an unsorted query whose limit the first responses already satisfy:
+    // an outstanding request may still open a cursor on its shard, so returning early would leak
+    // that cursor until it times out.
     params.remotes = establishCursors(opCtx,
                                       Grid::get(opCtx)->getExecutorPool()->getArbitraryExecutor(),
                                       query.nss(),
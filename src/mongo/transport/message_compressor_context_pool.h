@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "mongo/platform/mutex.h"
+
+namespace mongo {
+
+/**
+ * A bounded pool of idle compression library contexts (zstd contexts, zlib streams), so that
+ * setting up a context's workspace is paid once rather than for every message. Compressors are
+ * shared by all sessions, so each compress or decompress call checks a context out for its
+ * duration and returns it afterwards.
+ */
+template <typename Context>
+class MessageCompressorContextPool {
+    MessageCompressorContextPool(const MessageCompressorContextPool&) = delete;
+    MessageCompressorContextPool& operator=(const MessageCompressorContextPool&) = delete;
+
+public:
+    // Bounds the number of idle contexts kept, so that a burst of concurrent messages doesn't pin
+    // its peak number of contexts for the lifetime of the process.
+    static constexpr size_t kMaxIdleContexts = 16;
+
+    MessageCompressorContextPool(std::function<Context*()> create,
+                                 std::function<void(Context*)> destroy)
+        : _create(std::move(create)), _destroy(std::move(destroy)) {}
+
+    ~MessageCompressorContextPool() {
+        for (auto context : _idle) {
+            _destroy(context);
+        }
+    }
+
+    /**
+     * Returns an idle context, or a newly created one if there is none. Returns nullptr if a new
+     * context could not be created.
+     */
+    Context* checkOut() {
+        {
+            stdx::lock_guard lk(_mutex);
+            if (!_idle.empty()) {
+                auto context = _idle.back();
+                _idle.pop_back();
+                return context;
+            }
+        }
+        return _create();
+    }
+
+    /**
+     * Returns a context obtained from checkOut() to the pool, or destroys it if the pool is full.
+     */
+    void checkIn(Context* context) {
+        {
+            stdx::lock_guard lk(_mutex);
+            if (_idle.size() < kMaxIdleContexts) {
+                _idle.push_back(context);
+                return;
+            }
+        }
+        _destroy(context);
+    }
+
+private:
+    const std::function<Context*()> _create;
+    const std::function<void(Context*)> _destroy;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("MessageCompressorContextPool::_mutex");
+    std::vector<Context*> _idle;
+};
+
+}  // namespace mongo
@@ -34,12 +34,38 @@
 #include "mongo/base/init.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_zlib.h"
+#include "mongo/util/scopeguard.h"
 
 #include <zlib.h>
 
 namespace mongo {
 
-ZlibMessageCompressor::ZlibMessageCompressor() : MessageCompressorBase(MessageCompressor::kZlib) {}
+ZlibMessageCompressor::ZlibMessageCompressor()
+    : MessageCompressorBase(MessageCompressor::kZlib),
+      _deflateStreams(
+          []() -> z_stream* {
+              auto stream = std::make_unique<z_stream>();
+              if (::deflateInit(stream.get(), Z_DEFAULT_COMPRESSION) != Z_OK) {
+                  return nullptr;
+              }
+              return stream.release();
+          },
+          [](z_stream* stream) {
+              ::deflateEnd(stream);
+              delete stream;
+          }),
+      _inflateStreams(
+          []() -> z_stream* {
+              auto stream = std::make_unique<z_stream>();
+              if (::inflateInit(stream.get()) != Z_OK) {
+                  return nullptr;
+              }
+              return stream.release();
+          },
+          [](z_stream* stream) {
+              ::inflateEnd(stream);
+              delete stream;
+          }) {}
 
 std::size_t ZlibMessageCompressor::getMaxCompressedSize(size_t inputSize) {
     return ::compressBound(inputSize);
@@ -47,29 +73,47 @@ std::size_t ZlibMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZlibMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t outLength = output.length();
-    int ret = ::compress2(const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data())),
-                          reinterpret_cast<uLongf*>(&outLength),
-                          reinterpret_cast<const Bytef*>(input.data()),
-                          input.length(),
-                          Z_DEFAULT_COMPRESSION);
+    auto stream = _deflateStreams.checkOut();
+    if (!stream) {
+        return Status{ErrorCodes::ExceededMemoryLimit, "Could not allocate compression stream"};
+    }
+    ON_BLOCK_EXIT([&] { _deflateStreams.checkIn(stream); });
+
+    int ret = ::deflateReset(stream);
+    if (ret == Z_OK) {
+        stream->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input.data()));
+        stream->avail_in = input.length();
+        stream->next_out = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data()));
+        stream->avail_out = output.length();
+        ret = ::deflate(stream, Z_FINISH);
+    }
 
-    if (ret != Z_OK) {
+    if (ret != Z_STREAM_END) {
         return Status{ErrorCodes::BadValue, "Could not compress input"};
     }
+    size_t outLength = stream->total_out;
     counterHitCompress(input.length(), outLength);
     return {outLength};
 }
 
 StatusWith<std::size_t> ZlibMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    uLongf length = output.length();
-    int ret = ::uncompress(const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data())),
-                           &length,
-                           reinterpret_cast<const Bytef*>(input.data()),
-                           input.length());
+    auto stream = _inflateStreams.checkOut();
+    if (!stream) {
+        return Status{ErrorCodes::ExceededMemoryLimit, "Could not allocate decompression stream"};
+    }
+    ON_BLOCK_EXIT([&] { _inflateStreams.checkIn(stream); });
 
-    if (ret != Z_OK) {
+    int ret = ::inflateReset(stream);
+    if (ret == Z_OK) {
+        stream->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input.data()));
+        stream->avail_in = input.length();
+        stream->next_out = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(output.data()));
+        stream->avail_out = output.length();
+        ret = ::inflate(stream, Z_FINISH);
+    }
+
+    if (ret != Z_STREAM_END) {
         return Status{ErrorCodes::BadValue, "Compressed message was invalid or corrupted"};
     }
 
@@ -77,7 +121,6 @@ StatusWith<std::size_t> ZlibMessageCompressor::decompressData(ConstDataRange inp
     return {output.length()};
 }
 
-
 MONGO_INITIALIZER_GENERAL(ZlibMessageCompressorInit,
                           ("EndStartupOptionHandling"),
                           ("AllCompressorsRegistered"))
@@ -28,6 +28,9 @@
  */
 
 #include "mongo/transport/message_compressor_base.h"
+#include "mongo/transport/message_compressor_context_pool.h"
+
+struct z_stream_s;
 
 namespace mongo {
 class ZlibMessageCompressor final : public MessageCompressorBase {
@@ -39,6 +42,12 @@ public:
     StatusWith<std::size_t> compressData(ConstDataRange input, DataRange output) override;
 
     StatusWith<std::size_t> decompressData(ConstDataRange input, DataRange output) override;
+
+private:
+    // Initialized deflate and inflate streams, reset between messages instead of being set up
+    // from scratch by every compress2() and uncompress() call.
+    MessageCompressorContextPool<z_stream_s> _deflateStreams;
+    MessageCompressorContextPool<z_stream_s> _inflateStreams;
 };
 
 
@@ -36,10 +36,16 @@
 #include "mongo/base/init.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_zstd.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
-ZstdMessageCompressor::ZstdMessageCompressor() : MessageCompressorBase(MessageCompressor::kZstd) {}
+ZstdMessageCompressor::ZstdMessageCompressor()
+    : MessageCompressorBase(MessageCompressor::kZstd),
+      _compressionContexts([] { return ZSTD_createCCtx(); },
+                           [](ZSTD_CCtx* context) { ZSTD_freeCCtx(context); }),
+      _decompressionContexts([] { return ZSTD_createDCtx(); },
+                             [](ZSTD_DCtx* context) { ZSTD_freeDCtx(context); }) {}
 
 std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
     return ZSTD_compressBound(inputSize);
@@ -47,11 +53,18 @@ std::size_t ZstdMessageCompressor::getMaxCompressedSize(size_t inputSize) {
 
 StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input,
                                                             DataRange output) {
-    size_t ret = ZSTD_compress(const_cast<char*>(output.data()),
-                               output.length(),
-                               input.data(),
-                               input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+    auto context = _compressionContexts.checkOut();
+    if (!context) {
+        return Status{ErrorCodes::ExceededMemoryLimit, "Could not allocate compression context"};
+    }
+    ON_BLOCK_EXIT([&] { _compressionContexts.checkIn(context); });
+
+    size_t ret = ZSTD_compressCCtx(context,
+                                   const_cast<char*>(output.data()),
+                                   output.length(),
+                                   input.data(),
+                                   input.length(),
+                                   ZSTD_CLEVEL_DEFAULT);
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
@@ -63,8 +76,17 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
 
 StatusWith<std::size_t> ZstdMessageCompressor::decompressData(ConstDataRange input,
                                                               DataRange output) {
-    size_t ret = ZSTD_decompress(
-        const_cast<char*>(output.data()), output.length(), input.data(), input.length());
+    auto context = _decompressionContexts.checkOut();
+    if (!context) {
+        return Status{ErrorCodes::ExceededMemoryLimit, "Could not allocate decompression context"};
+    }
+    ON_BLOCK_EXIT([&] { _decompressionContexts.checkIn(context); });
+
+    size_t ret = ZSTD_decompressDCtx(context,
+                                     const_cast<char*>(output.data()),
+                                     output.length(),
+                                     input.data(),
+                                     input.length());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
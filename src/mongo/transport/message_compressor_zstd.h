@@ -28,6 +28,10 @@
  */
 
 #include "mongo/transport/message_compressor_base.h"
+#include "mongo/transport/message_compressor_context_pool.h"
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
 
 namespace mongo {
 class ZstdMessageCompressor final : public MessageCompressorBase {
@@ -41,6 +45,10 @@ public:
     StatusWith<std::size_t> decompressData(ConstDataRange input, DataRange output) override;
 
     std::size_t getMaxDecompressedSize(const void* src, size_t srcSize);
+
+private:
+    MessageCompressorContextPool<ZSTD_CCtx_s> _compressionContexts;
+    MessageCompressorContextPool<ZSTD_DCtx_s> _decompressionContexts;
 };
 
 
@@ -52,6 +52,10 @@ namespace transport {
  * A service executor that uses a fixed (configurable) number of threads to execute tasks.
  * This executor always yields before executing scheduled tasks, and never yields before scheduling
  * new tasks (i.e., `ScheduleFlags::kMayYieldBeforeSchedule` is a no-op for this executor).
+ *
+ * All sessions share the single queue of the underlying ThreadPool, and a session keeps no
+ * affinity to the thread that last ran it. Locality comes instead from `kMayRecurse` tasks, which
+ * run inline on the scheduling thread up to `fixedServiceExecutorRecursionLimit` deep.
  */
 class ServiceExecutorFixed final : public ServiceExecutor,
                                    public std::enable_shared_from_this<ServiceExecutorFixed> {
@@ -128,6 +128,10 @@ public:
      * Source -> SourceWait -> Process -> SinkWait -> Source (standard RPC)
      * Source -> SourceWait -> Process -> SinkWait -> Process -> SinkWait ... (exhaust)
      * Source -> SourceWait -> Process -> Source (fire-and-forget)
+     *
+     * In exhaust, the next batch is only built once the previous reply has been sunk. Producing it
+     * while the sink is still in flight would need a second opCtx on the same client and would
+     * lose the backpressure a slow reader exerts on the cursor.
      */
     enum class State {
         Created,     // The session has been created, but no operations have been performed yet
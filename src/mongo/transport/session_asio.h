@@ -163,6 +163,8 @@ protected:
 private:
     GenericSocket& getSocket();
 
+    // Reads the message header and then the body, each with a synchronous read attempt before
+    // falling back to waiting on the reactor or baton (see opportunisticRead below).
     Future<Message> sourceMessageImpl(const BatonHandle& baton = nullptr);
 
     template <typename MutableBufferSequence>
@@ -216,6 +218,10 @@ private:
                                     const BatonHandle& baton = nullptr);
 
 #ifdef MONGO_CONFIG_SSL
+    // Runs the server side of the TLS handshake on the first read of the session, so it executes on
+    // the session's own service executor thread rather than on the listener's accept path. The
+    // number of concurrent handshakes is therefore already bounded by maxIncomingConnections and
+    // the service executor's limits.
     template <typename MutableBufferSequence>
     Future<bool> maybeHandshakeSSLForIngress(const MutableBufferSequence& buffer);
 #endif
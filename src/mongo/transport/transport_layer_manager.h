@@ -50,6 +50,12 @@ namespace transport {
  * TransportLayers. Mongod and Mongos can treat this like the "only" TransportLayer
  * and not be concerned with which other TransportLayer implementations it holds
  * underneath.
+ *
+ * createWithConfig() only ever installs TransportLayerASIO. Another implementation, such as a
+ * kernel-bypass transport for intra-cluster traffic, would be one more entry in '_tls'. Egress
+ * would still need routing: the OplogFetcher connects through DBClientConnection, and
+ * replSetUpdatePosition is sent by the replication executor's NetworkInterfaceTL. Both
+ * reach the network only through the service context's TransportLayer.
  */
 class TransportLayerManager final : public TransportLayer {
     TransportLayerManager(const TransportLayerManager&) = delete;
@@ -99,6 +99,11 @@ private:
 
 #else
 
+/**
+ * Spins briefly, then yields the CPU, and finally sleeps between attempts (see _lockSlowPath()),
+ * so it suits very short critical sections on hot latches. Mutex, by contrast, parks in the kernel
+ * as soon as it is contended.
+ */
 class SpinLock : public latch_detail::Latch {
     SpinLock(const SpinLock&) = delete;
     SpinLock& operator=(const SpinLock&) = delete;
@@ -41,6 +41,12 @@
 
 namespace mongo {
 
+/**
+ * Admission is first-come first-served, with no notion of operation cost or priority. A long
+ * running query does not hold its ticket for its whole duration: yielding releases the global lock
+ * and with it the ticket, so queued operations get a turn every internalQueryExecYieldIterations
+ * or internalQueryExecYieldPeriodMS.
+ */
 class TicketHolder {
     TicketHolder(const TicketHolder&) = delete;
     TicketHolder& operator=(const TicketHolder&) = delete;
@@ -198,6 +198,19 @@ void BM_futureInt4xDeferredThenChained(benchmark::State& state) {
     }
 }
 
+void BM_futureIntDeferredThenChain(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        auto pf = makePromiseFuture<int>();
+        auto fut = std::move(pf.future);
+        // Every continuation attached to a future that is not ready yet gets its own shared state.
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            fut = std::move(fut).then([](int v) { return v + 1; });
+        }
+        pf.promise.emplaceValue(1);
+        benchmark::DoNotOptimize(std::move(fut).get());
+    }
+}
 
 BENCHMARK(BM_plainIntReady);
 BENCHMARK(BM_futureIntReady);
@@ -212,5 +225,6 @@ BENCHMARK(BM_futureInt3xDeferredThenNested);
 BENCHMARK(BM_futureInt3xDeferredThenChained);
 BENCHMARK(BM_futureInt4xDeferredThenNested);
 BENCHMARK(BM_futureInt4xDeferredThenChained);
+BENCHMARK(BM_futureIntDeferredThenChain)->RangeMultiplier(4)->Range(1, 64);
 
 }  // namespace mongo
@@ -29,11 +29,13 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
 #include <boost/optional.hpp>
 #include <cstdlib>
 #include <iterator>
 #include <list>
 
+#include "mongo/stdx/trusted_hasher.h"
 #include "mongo/stdx/unordered_map.h"
 
 namespace mongo {
@@ -45,7 +47,9 @@ namespace mongo {
  * This cache is not thread safe.
  *
  * Internally, this structure holds two containers: a list for LRU ordering and an
- * unordered_map for fast lookup. The add(), get(), and remove() operations are all O(1).
+ * open-addressing hash table, which stores each key next to its list position, for fast lookup.
+ * The list node is the only per-entry allocation, and promoting an entry splices its node in place
+ * without allocating. The add(), get(), and remove() operations are all O(1).
  *
  * Iteration over the cache will visit elements in order of last use, from most
  * recently used to least recently used.
@@ -95,7 +99,7 @@ public:
     using iterator = typename List::iterator;
     using const_iterator = typename List::const_iterator;
 
-    using Map = stdx::unordered_map<K, iterator, Hash, KeyEqual>;
+    using Map = absl::flat_hash_map<K, iterator, EnsureTrustedHasher<Hash, K>, KeyEqual>;
 
     using key_type = K;
     using mapped_type = V;
@@ -112,14 +116,18 @@ public:
      * to this method throws, the cache may be left in an inconsistent state.
      */
     boost::optional<std::pair<K, V>> add(const K& key, V entry) {
-        // If the key already exists, delete it first.
+        // If the key already exists, replace its value and mark it most recently used. The map
+        // entry is kept and only repointed at the new front of the list.
         auto i = _map.find(key);
         if (i != _map.end()) {
             _list.erase(i->second);
+            _list.push_front(std::make_pair(key, std::move(entry)));
+            i->second = _list.begin();
+            return boost::none;
         }
 
         _list.push_front(std::make_pair(key, std::move(entry)));
-        _map[key] = _list.begin();
+        _map.emplace(key, _list.begin());
 
         // If the store has grown beyond its allowed size,
         // evict the least recently used entry.
@@ -316,7 +324,8 @@ private:
     // least recently used.
     List _list;
 
-    // Maps from a key to the corresponding std::list entry.
+    // Maps from a key to the corresponding std::list entry. Promotion never changes which node a
+    // key maps to, so lookups do not need to modify the map.
     Map _map;
 };
 
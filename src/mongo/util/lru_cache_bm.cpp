@@ -0,0 +1,128 @@
+/**
+ *    Copyright (C) 2021-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/lru_cache.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace mongo {
+namespace {
+
+constexpr uint32_t kDefaultSeed = 34862;
+
+std::vector<std::string> makeKeys(size_t num) {
+    std::vector<std::string> keys;
+    keys.reserve(num);
+    for (size_t i = 0; i < num; ++i) {
+        keys.push_back(std::to_string(i));
+    }
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine(kDefaultSeed));
+    return keys;
+}
+
+/**
+ * Measures the cost of a cache hit, which promotes the found entry to the most recently used
+ * position. This is the path taken by plan cache and user cache lookups.
+ */
+void BM_LRUCacheHit(benchmark::State& state) {
+    const size_t num = state.range(0);
+    auto keys = makeKeys(num);
+
+    LRUCache<std::string, int> cache(num);
+    for (size_t i = 0; i < num; ++i) {
+        cache.add(keys[i], i);
+    }
+    std::shuffle(keys.begin(), keys.end(), std::default_random_engine(kDefaultSeed + 1));
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.find(keys[i]));
+        if (++i == num) {
+            i = 0;
+        }
+    }
+
+    state.counters["size"] = num;
+}
+
+/**
+ * Measures the cost of inserting into a full cache, where every add evicts the least recently
+ * used entry.
+ */
+void BM_LRUCacheAddWithEviction(benchmark::State& state) {
+    const size_t num = state.range(0);
+    auto keys = makeKeys(2 * num);
+
+    LRUCache<std::string, int> cache(num);
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.add(keys[i], i));
+        if (++i == keys.size()) {
+            i = 0;
+        }
+    }
+
+    state.counters["size"] = num;
+}
+
+/**
+ * Measures the cost of looking up a key which is not in the cache.
+ */
+void BM_LRUCacheMiss(benchmark::State& state) {
+    const size_t num = state.range(0);
+    auto keys = makeKeys(2 * num);
+
+    LRUCache<std::string, int> cache(num);
+    for (size_t i = 0; i < num; ++i) {
+        cache.add(keys[i], i);
+    }
+
+    size_t i = num;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.find(keys[i]));
+        if (++i == keys.size()) {
+            i = num;
+        }
+    }
+
+    state.counters["size"] = num;
+}
+
+BENCHMARK(BM_LRUCacheHit)->RangeMultiplier(8)->Range(8, 1 << 18);
+BENCHMARK(BM_LRUCacheAddWithEviction)->RangeMultiplier(8)->Range(8, 1 << 18);
+BENCHMARK(BM_LRUCacheMiss)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+}  // namespace
+}  // namespace mongo
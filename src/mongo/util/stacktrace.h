@@ -299,6 +299,10 @@ void markAsStackTraceProcessingThread();
  * asynchronous signal from an external `kill`. The signal processing thread calls this
  * function when it receives the signal for the process. This function then sends the
  * same signal via `tgkill` to every other thread and collects their responses.
+ *
+ * This is an on-demand snapshot, not a sampling profiler: each request interrupts every thread
+ * and symbolizes every stack, which is too heavy to repeat continuously. Folding repeated
+ * snapshots into per-stack counts gives a coarse CPU profile without external tooling.
  */
 void printAllThreadStacks();
 void printAllThreadStacks(StackTraceSink& sink);
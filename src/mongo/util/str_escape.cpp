@@ -31,12 +31,46 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 
 namespace mongo::str {
 namespace {
 constexpr char kHexChar[] = "0123456789abcdef";
 
+/**
+ * Returns the length of the longest prefix of 'str' made up of printable ASCII that a JSON string
+ * can carry verbatim, i.e. no control characters, DEL, '"', '\\' or bytes of multi-byte UTF-8
+ * sequences. Plain input is checked eight bytes at a time.
+ */
+size_t jsonSafePrefixLength(StringData str) {
+    constexpr uint64_t kOnes = 0x0101010101010101ULL;
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    auto hasZeroByte = [&](uint64_t v) { return (v - kOnes) & ~v & kHighBits; };
+
+    const char* data = str.rawData();
+    size_t len = str.size();
+    size_t pos = 0;
+    for (; pos + sizeof(uint64_t) <= len; pos += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + pos, sizeof(word));
+        // Bytes below 0x20, bytes of 0x7f and above, and the two characters JSON always escapes.
+        uint64_t unsafe = ((word - kOnes * 0x20) & ~word) | ((word + kOnes) | word);
+        if ((unsafe & kHighBits) || hasZeroByte(word ^ (kOnes * '"')) ||
+            hasZeroByte(word ^ (kOnes * '\\'))) {
+            break;
+        }
+    }
+    for (; pos < len; ++pos) {
+        uint8_t c = data[pos];
+        if (c < 0x20 || c >= 0x7f || c == '"' || c == '\\') {
+            break;
+        }
+    }
+    return pos;
+}
+
 // 'singleHandler' Function to write a valid single byte UTF-8 sequence with desired escaping.
 // 'invalidByteHandler' Function to write a byte of invalid UTF-8 encoding
 // 'twoEscaper' Function to write a valid two byte UTF-8 sequence with desired escaping, for C1
@@ -297,6 +331,15 @@ std::string escapeForText(StringData str) {
 }
 
 void escapeForJSON(fmt::memory_buffer& buffer, StringData str) {
+    // Most strings are plain ASCII, so copy the leading run that needs no escaping in one go
+    // before falling back to examining the remainder one code point at a time.
+    auto safeLen = jsonSafePrefixLength(str);
+    buffer.append(str.rawData(), str.rawData() + safeLen);
+    str = str.substr(safeLen);
+    if (str.empty()) {
+        return;
+    }
+
     auto singleByteHandler = [](const auto& writer, uint8_t unescaped) {
         switch (unescaped) {
             case '\0':